@@ -41,10 +41,45 @@ using namespace lightspark;
 using namespace std;
 
 asfreelist::~asfreelist()
+{
+	clear();
+}
+
+void asfreelist::clear()
 {
 	for (int i = 0; i < freelistsize; i++)
 		delete freelist[i];
 	freelistsize = 0;
+	if (freelist != initialfreelist)
+		delete[] freelist;
+	freelist = initialfreelist;
+	freelistcapacity = FREELIST_SIZE;
+	overflowcount = 0;
+}
+
+#ifdef MEMORY_USAGE_PROFILING
+void asfreelist::accountPooledObject(ASObject* obj, bool pooled)
+{
+	MemoryAccount* m = pooled ? obj->getSystemState()->freelistMemory : (obj->getClass() ? obj->getClass()->memoryAccount : nullptr);
+	// the allocation starts at the most derived object
+	memory_reporter::setMemoryAccount(dynamic_cast<void*>(obj),m);
+}
+#endif
+
+bool asfreelist::grow()
+{
+	// only grow if as many objects were dropped as the pool can hold, so rarely used classes keep the small pool
+	if (freelistcapacity >= FREELIST_MAX_SIZE || ++overflowcount < freelistcapacity)
+		return false;
+	int newcapacity = freelistcapacity*2;
+	ASObject** newfreelist = new ASObject*[newcapacity];
+	memcpy(newfreelist,freelist,freelistsize*sizeof(ASObject*));
+	if (freelist != initialfreelist)
+		delete[] freelist;
+	freelist = newfreelist;
+	freelistcapacity = newcapacity;
+	overflowcount = 0;
+	return true;
 }
 
 string ASObject::toDebugString() const
@@ -844,6 +879,40 @@ variable* ASObject::findSettable(const multiname& name, bool* has_getter)
 	return findSettableImpl(getSystemState(),Variables, name, has_getter);
 }
 
+variable* ASObject::findCachedSlotVar(const multiname& name)
+{
+	if (!classdef || classdef->slotcacheid == 0 || name.name_type != multiname::NAME_STRING)
+		return nullptr;
+	const multiname::slotcacheentry* e = name.getCachedSlot(classdef->slotcacheid);
+	if (!e || e->nameid != name.name_s_id || e->slotid > Variables.slotcount)
+		return nullptr;
+	variable* v = Variables.getSlotVar(e->slotid);
+	if (!v || v->ns.nsId != e->nsid || v->kind != DECLARED_TRAIT || asAtomHandler::isValid(v->getter) || asAtomHandler::isValid(v->setter))
+		return nullptr;
+	// the namespaces of the name may have changed since the slot was cached
+	if (!name.ns.empty() && std::find(name.ns.begin(),name.ns.end(),v->ns) == name.ns.end())
+		return nullptr;
+	return v;
+}
+
+void ASObject::cacheSlotVar(const multiname& name, variable* v)
+{
+	// only instances of sealed AS3 classes are guaranteed to share their slot layout
+	if (!name.isStatic
+			|| name.name_type != multiname::NAME_STRING
+			|| v->slotid == 0
+			|| v->kind != DECLARED_TRAIT
+			|| asAtomHandler::isValid(v->getter)
+			|| asAtomHandler::isValid(v->setter)
+			|| !classdef
+			|| classdef->slotcacheid == 0
+			|| !classdef->isSealed
+			|| !classdef->is<Class_inherit>()
+			|| this->is<Class_base>())
+		return;
+	name.setCachedSlot(classdef->slotcacheid,v->ns.nsId,v->slotid);
+}
+
 multiname *ASObject::setVariableByMultiname_intern(multiname& name, asAtom& o, CONST_ALLOWED_FLAG allowConst, Class_base* cls, bool *alreadyset, ASWorker* wrk)
 {
 	multiname *retval = nullptr;
@@ -851,7 +920,13 @@ multiname *ASObject::setVariableByMultiname_intern(multiname& name, asAtom& o, C
 	assert(!cls || classdef->isSubClass(cls));
 	//NOTE: we assume that [gs]etSuper and [sg]etProperty correctly manipulate the cur_level (for getActualClass)
 	bool has_getter=false;
-	variable* obj=findSettable(name, &has_getter);
+	variable* obj=findCachedSlotVar(name);
+	if (!obj)
+	{
+		obj=findSettable(name, &has_getter);
+		if (obj)
+			cacheSlotVar(name,obj);
+	}
 
 	if (obj && (obj->kind == CONSTANT_TRAIT && allowConst==CONST_NOT_ALLOWED))
 	{
@@ -1520,9 +1595,20 @@ GET_VARIABLE_RESULT ASObject::getVariableByMultinameIntern(asAtom &ret, const mu
 	assert(wrk==getWorker());
 	uint32_t nsRealId;
 	GET_VARIABLE_RESULT res = GET_VARIABLE_RESULT::GETVAR_NORMAL;
-	variable* obj=Variables.findObjVar(getSystemState(),name,((opt & FROM_GETLEX) || name.hasEmptyNS || name.hasBuiltinNS || name.ns.empty()) ? DECLARED_TRAIT|DYNAMIC_TRAIT : DECLARED_TRAIT,&nsRealId);
+	variable* obj=findCachedSlotVar(name);
+	// invalid slots fall through to the regular lookup, so borrowed and class traits are found
+	if (obj && asAtomHandler::isValid(obj->var) && !asAtomHandler::isFunction(obj->var))
+	{
+		// fast path for plain variables of sealed class instances, skips the hash lookup
+		if (!(opt & NO_INCREF))
+			ASATOM_INCREF(obj->var);
+		asAtomHandler::set(ret,obj->var);
+		return res;
+	}
+	obj=Variables.findObjVar(getSystemState(),name,((opt & FROM_GETLEX) || name.hasEmptyNS || name.hasBuiltinNS || name.ns.empty()) ? DECLARED_TRAIT|DYNAMIC_TRAIT : DECLARED_TRAIT,&nsRealId);
 	if(obj)
 	{
+		cacheSlotVar(name,obj);
 		//It seems valid for a class to redefine only the setter, so if we can't find
 		//something to get, it's ok
 		if(!(asAtomHandler::isValid(obj->getter) || asAtomHandler::isValid(obj->var)))
@@ -286,15 +286,35 @@ class MouseEvent;
 class Event;
 
 #define FREELIST_SIZE 16
+#define FREELIST_MAX_SIZE 1024
+// per worker pool of destructed objects of one class that can be reused
+// the pool starts with FREELIST_SIZE entries and grows up to FREELIST_MAX_SIZE entries
+// if objects of this class are frequently released while the pool is full
 struct asfreelist
 {
-	ASObject* freelist[FREELIST_SIZE];
+	ASObject* initialfreelist[FREELIST_SIZE];
+	ASObject** freelist;
 	int freelistsize;
-	asfreelist():freelistsize(0) {}
+	int freelistcapacity;
+	int overflowcount;
+	asfreelist():freelist(initialfreelist),freelistsize(0),freelistcapacity(FREELIST_SIZE),overflowcount(0) {}
 	~asfreelist();
+	// freelist may point into this object, so it can't be copied or moved
+	asfreelist(const asfreelist&) = delete;
+	asfreelist(asfreelist&&) = delete;
+	asfreelist& operator=(const asfreelist&) = delete;
+	asfreelist& operator=(asfreelist&&) = delete;
 
 	inline ASObject* getObjectFromFreeList();
 	inline bool pushObjectToFreeList(ASObject *obj);
+	// deletes all pooled objects
+	void clear();
+private:
+	bool grow();
+#ifdef MEMORY_USAGE_PROFILING
+	// reports pooled objects in SystemState::freelistMemory instead of the memory account of their class
+	void accountPooledObject(ASObject* obj, bool pooled);
+#endif
 };
 
 extern SystemState* getSys();
@@ -879,6 +899,9 @@ private:
 	}
 	
 	variable* findSettable(const multiname& name, bool* has_getter=nullptr) DLL_LOCAL;
+	// returns the plain declared variable from the slot that was cached in name for the class of this object
+	variable* findCachedSlotVar(const multiname& name) DLL_LOCAL;
+	void cacheSlotVar(const multiname& name, variable* v) DLL_LOCAL;
 	multiname* proxyMultiName;
 	SystemState* sys;
 	ASWorker* worker;
@@ -2641,17 +2664,24 @@ inline ASObject* asfreelist::getObjectFromFreeList()
 	assert(freelistsize>=0);
 	ASObject* o = freelistsize ? freelist[--freelistsize] :nullptr;
 	LOG_CALL("getfromfreelist:"<<freelistsize<<" "<<o<<" "<<this);
+#ifdef MEMORY_USAGE_PROFILING
+	if (o)
+		accountPooledObject(o,false);
+#endif
 	return o;
 }
 inline bool asfreelist::pushObjectToFreeList(ASObject *obj)
 {
-	if (freelistsize < FREELIST_SIZE)
+	if (freelistsize < freelistcapacity || grow())
 	{
 		assert(freelistsize>=0);
 		LOG_CALL("pushtofreelist:"<<freelistsize<<" "<<obj<<" "<<this);
 		obj->setCached();
 		obj->resetRefCount();
 		freelist[freelistsize++]=obj;
+#ifdef MEMORY_USAGE_PROFILING
+		accountPooledObject(obj,true);
+#endif
 		return true;
 	}
 	return false;
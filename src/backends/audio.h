@@ -44,6 +44,8 @@ public:
 	Mutex streamMutex;
 	Mutex managerMutex;
 	std::list<AudioStream *> streams;
+	// buffer the audio callback decodes into, protected by streamMutex
+	std::vector<uint8_t> mixbuffer;
 	SDL_AudioDeviceID device;
 	AudioManager(EngineData* engine);
 
@@ -145,6 +145,19 @@ void VideoDecoder::waitForFencing()
 }
 
 #ifdef ENABLE_LIBAVCODEC
+/*
+ * Let libavcodec decode the slices of a frame in parallel.
+ * Frame threading is not enabled, as it delays the output by one frame per thread,
+ * while decodeData() relies on getting the frame of the packet it just sent
+ */
+static void setupCodecThreading(AVCodecContext* codecContext)
+{
+#ifdef FF_THREAD_SLICE
+	codecContext->thread_count=0; // choose the number of threads automatically
+	codecContext->thread_type=FF_THREAD_SLICE;
+#endif
+}
+
 bool FFMpegVideoDecoder::fillDataAndCheckValidity()
 {
 	if(frameRate==0 && codecContext->time_base.num!=0)
@@ -247,6 +260,7 @@ void FFMpegVideoDecoder::switchCodec(LS_VIDEO_CODEC codecId, uint8_t *initdata,
 		codecContext->extradata=initdata;
 		codecContext->extradata_size=datalen;
 	}
+	setupCodecThreading(codecContext);
 #ifdef HAVE_AVCODEC_OPEN2
 	if(avcodec_open2(codecContext, codec, nullptr)<0)
 #else
@@ -290,6 +304,7 @@ FFMpegVideoDecoder::FFMpegVideoDecoder(AVCodecParameters* codecPar, double frame
 	}
 	avcodec_parameters_to_context(codecContext,codecPar);
 	const AVCodec* codec=avcodec_find_decoder(codecPar->codec_id);
+	setupCodecThreading(codecContext);
 #ifdef HAVE_AVCODEC_OPEN2
 	if(avcodec_open2(codecContext, codec, nullptr)<0)
 #else
@@ -325,6 +340,7 @@ FFMpegVideoDecoder::FFMpegVideoDecoder(AVCodecContext* _c, double frameRateHint)
 			return;
 	}
 	const AVCodec* codec=avcodec_find_decoder(codecContext->codec_id);
+	setupCodecThreading(codecContext);
 #ifdef HAVE_AVCODEC_OPEN2
 	if(avcodec_open2(codecContext, codec, nullptr)<0)
 #else
@@ -669,11 +685,10 @@ uint8_t* FFMpegVideoDecoder::upload(bool refresh)
 			uint32_t texw= (frameWidth+15)&0xfffffff0;
 			for(uint32_t i=0;i<frameHeight;i++)
 			{
+				const uint8_t* alpharow=cur->ch[3]+i*frameWidth;
+				uint8_t* outrow=decodedframebuffer+i*texw*4+3;
 				for(uint32_t j=0;j<frameWidth;j++)
-				{
-					uint32_t pixelCoordFull=i*texw+j;
-					decodedframebuffer[pixelCoordFull*4+3]=cur->ch[3][i*frameWidth+j];
-				}
+					outrow[j*4]=alpharow[j];
 			}
 		}
 	}
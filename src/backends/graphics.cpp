@@ -768,6 +768,9 @@ bool CairoRenderer::isCachedSurfaceUsable(const DisplayObject* o) const
 bool CairoTokenRenderer::hitTest(const tokensVector& tokens, float scaleFactor, number_t x, number_t y)
 {
 	cairo_surface_t* cairoSurface=cairo_image_surface_create_for_data(nullptr, CAIRO_FORMAT_ARGB32, 0, 0, 0);
+	// the same context is used for all paths of the tokenvector, it is reset before each path
+	cairo_t *cr=cairo_create(cairoSurface);
+	cairo_set_fill_rule(cr, CAIRO_FILL_RULE_EVEN_ODD);
 
 	int starttoken=0;
 	bool ret=false;
@@ -775,9 +778,9 @@ bool CairoTokenRenderer::hitTest(const tokensVector& tokens, float scaleFactor,
 	while (starttoken >=0)
 	{
 		// loop over all paths of the tokenvector separately
-		cairo_t *cr=cairo_create(cairoSurface);
+		cairo_new_path(cr);
+		cairo_identity_matrix(cr);
 		cairo_set_operator (cr, CAIRO_OPERATOR_OVER);
-		cairo_set_fill_rule(cr, CAIRO_FILL_RULE_EVEN_ODD);
 		empty=cairoPathFromTokens(cr, tokens, scaleFactor, true,true,0,0,nullptr,&starttoken);
 		if(!empty)
 		{
@@ -787,13 +790,10 @@ bool CairoTokenRenderer::hitTest(const tokensVector& tokens, float scaleFactor,
 			cairo_identity_matrix(cr);
 			ret=cairo_in_fill(cr, x, y);
 			if (ret)
-			{
-				cairo_destroy(cr);
 				break;
-			}
 		}
-		cairo_destroy(cr);
 	}
+	cairo_destroy(cr);
 	cairo_surface_destroy(cairoSurface);
 	return ret;
 }
@@ -814,11 +814,122 @@ CairoTokenRenderer::CairoTokenRenderer(const tokensVector &_g, const MATRIX &_m,
 									   , float _xs, float _ys, bool _im, _NR<DisplayObject> _mask, float _s, float _a
 									   , const std::vector<IDrawable::MaskData> &_ms
 									   , const ColorTransformBase& _colortransform
-									   , SMOOTH_MODE _smoothing, number_t _xstart, number_t _ystart, bool _softwarerenderer)
+									   , SMOOTH_MODE _smoothing, number_t _xstart, number_t _ystart, bool _softwarerenderer
+									   , ShapeRasterCache* _rastercache)
 	: CairoRenderer(_m,_x,_y,_w,_h,_rx,_ry,_rw,_rh,_r,_xs,_ys,_im,_mask,_s,_a,_ms
 					, _colortransform
-					,_smoothing),tokens(_g),xstart(_xstart),ystart(_ystart),softwarerenderer(_softwarerenderer)
+					,_smoothing),tokens(_g),xstart(_xstart),ystart(_ystart),softwarerenderer(_softwarerenderer),rastercache(_rastercache)
+{
+}
+
+uint8_t* CairoTokenRenderer::getPixelBuffer(bool* isBufferOwner, uint32_t* bufsize)
+{
+	// masks depend on the position of the instance, so only unmasked shapes can share their pixels
+	if (!rastercache || isMask || !masks.empty() || width<=0 || height<=0 || !Config::getConfig()->isRenderingEnabled())
+		return CairoRenderer::getPixelBuffer(isBufferOwner,bufsize);
+	if (isBufferOwner)
+		*isBufferOwner=true;
+	if (bufsize)
+		*bufsize=width*height*4;
+	uint8_t* ret = rastercache->get(width,height,xscale,yscale,scaleFactor,xstart,ystart,colortransform,smoothing,softwarerenderer);
+	if (ret)
+		return ret;
+	ret = CairoRenderer::getPixelBuffer();
+	if (ret)
+		rastercache->put(ret,width*height*4,width,height,xscale,yscale,scaleFactor,xstart,ystart,colortransform,smoothing,softwarerenderer);
+	return ret;
+}
+
+Mutex ShapeRasterCache::lrumutex;
+std::list<ShapeRasterCache*> ShapeRasterCache::lru;
+uint64_t ShapeRasterCache::lrusize = 0;
+
+ShapeRasterCache::ShapeRasterCache(MemoryAccount* m):inlru(false),buffer(reporter_allocator<uint8_t>(m)),width(0),height(0),xscale(0),yscale(0),scaleFactor(0),
+	xstart(0),ystart(0),smoothing(SMOOTH_MODE::SMOOTH_NONE),softwarerenderer(false)
+{
+}
+
+ShapeRasterCache::~ShapeRasterCache()
+{
+	clear();
+}
+
+bool ShapeRasterCache::matches(int32_t _w, int32_t _h, float _xs, float _ys, float _s, number_t _xstart, number_t _ystart,
+							   const ColorTransformBase& _colortransform, SMOOTH_MODE _smoothing, bool _softwarerenderer)
+{
+	return !buffer.empty() && width==_w && height==_h && xscale==_xs && yscale==_ys && scaleFactor==_s
+			&& xstart==_xstart && ystart==_ystart && smoothing==_smoothing && softwarerenderer==_softwarerenderer
+			&& colortransform==_colortransform;
+}
+
+uint8_t* ShapeRasterCache::get(int32_t _w, int32_t _h, float _xs, float _ys, float _s, number_t _xstart, number_t _ystart,
+							   const ColorTransformBase& _colortransform, SMOOTH_MODE _smoothing, bool _softwarerenderer)
+{
+	uint8_t* ret = nullptr;
+	{
+		Locker l(mutex);
+		if (!matches(_w,_h,_xs,_ys,_s,_xstart,_ystart,_colortransform,_smoothing,_softwarerenderer))
+			return nullptr;
+		ret = new uint8_t[buffer.size()];
+		memcpy(ret,buffer.data(),buffer.size());
+	}
+	Locker l(lrumutex);
+	if (inlru)
+		lru.splice(lru.begin(),lru,lrupos);
+	return ret;
+}
+
+void ShapeRasterCache::put(const uint8_t* buf, uint32_t size, int32_t _w, int32_t _h, float _xs, float _ys, float _s, number_t _xstart, number_t _ystart,
+						   const ColorTransformBase& _colortransform, SMOOTH_MODE _smoothing, bool _softwarerenderer)
 {
+	if (size > SHAPERASTERCACHE_MAX_SIZE)
+		return;
+	Locker ll(lrumutex);
+	{
+		Locker l(mutex);
+		lrusize -= buffer.size();
+		buffer.assign(buf,buf+size);
+		lrusize += size;
+		width=_w;
+		height=_h;
+		xscale=_xs;
+		yscale=_ys;
+		scaleFactor=_s;
+		xstart=_xstart;
+		ystart=_ystart;
+		colortransform=_colortransform;
+		smoothing=_smoothing;
+		softwarerenderer=_softwarerenderer;
+	}
+	if (inlru)
+		lru.splice(lru.begin(),lru,lrupos);
+	else
+	{
+		lru.push_front(this);
+		lrupos=lru.begin();
+		inlru=true;
+	}
+	while (lrusize > SHAPERASTERCACHE_BUDGET && lru.back() != this)
+		lru.back()->clearIntern();
+}
+
+void ShapeRasterCache::clear()
+{
+	Locker l(lrumutex);
+	clearIntern();
+}
+
+void ShapeRasterCache::clearIntern()
+{
+	Locker l(mutex);
+	lrusize -= buffer.size();
+	buffer.clear();
+	buffer.shrink_to_fit();
+	if (inlru)
+	{
+		lru.erase(lrupos);
+		inlru=false;
+	}
 }
 
 void CairoRenderer::convertBitmapWithAlphaToCairo(std::vector<uint8_t, reporter_allocator<uint8_t>>& data, uint8_t* inData, uint32_t width,
@@ -1363,12 +1474,32 @@ void ColorTransformBase::applyTransformation(uint8_t* bm, uint32_t size)
 	if (isIdentity())
 		return;
 
+	applyTransformation(bm,bm,size);
+}
+void ColorTransformBase::applyTransformation(const uint8_t* src, uint8_t* dst, uint32_t size) const
+{
+	// every channel only has 256 possible values, so compute the transformed values once instead of for every pixel
+	uint8_t alphatable[256];
+	number_t alphafactor[256];
+	number_t redtable[256];
+	number_t greentable[256];
+	number_t bluetable[256];
+	for (uint32_t v = 0; v < 256; v++)
+	{
+		alphatable[v] = max(0,min(255,int(((number_t(v) * alphaMultiplier) + alphaOffset))));
+		alphafactor[v] = number_t(v)/255.0;
+		redtable[v] = (number_t(v) * redMultiplier) + redOffset;
+		greentable[v] = (number_t(v) * greenMultiplier) + greenOffset;
+		bluetable[v] = (number_t(v) * blueMultiplier) + blueOffset;
+	}
 	for (uint32_t i = 0; i < size; i+=4)
 	{
-		bm[i+3] = max(0,min(255,int(((number_t(bm[i+3]) * alphaMultiplier) + alphaOffset))));
-		bm[i+2] = max(0,min(255,int(((number_t(bm[i+2]) *  blueMultiplier) +  blueOffset)*(number_t(bm[i+3])/255.0))));
-		bm[i+1] = max(0,min(255,int(((number_t(bm[i+1]) * greenMultiplier) + greenOffset)*(number_t(bm[i+3])/255.0))));
-		bm[i  ] = max(0,min(255,int(((number_t(bm[i  ]) *   redMultiplier) +   redOffset)*(number_t(bm[i+3])/255.0))));
+		uint8_t a = alphatable[src[i+3]];
+		number_t f = alphafactor[a];
+		dst[i+3] = a;
+		dst[i+2] = max(0,min(255,int(bluetable[src[i+2]]*f)));
+		dst[i+1] = max(0,min(255,int(greentable[src[i+1]]*f)));
+		dst[i  ] = max(0,min(255,int(redtable[src[i  ]]*f)));
 	}
 }
 uint8_t *ColorTransformBase::applyTransformation(BitmapContainer* bm)
@@ -1386,12 +1517,6 @@ uint8_t *ColorTransformBase::applyTransformation(BitmapContainer* bm)
 	uint8_t* src = bm->getData();
 	uint8_t* dst = bm->getDataColorTransformed();
 	uint32_t size = bm->getWidth()*bm->getHeight()*4;
-	for (uint32_t i = 0; i < size; i+=4)
-	{
-		dst[i+3] = max(0,min(255,int(((number_t(src[i+3]) * alphaMultiplier) + alphaOffset))));
-		dst[i+2] = max(0,min(255,int(((number_t(src[i+2]) *  blueMultiplier) +  blueOffset)*(number_t(dst[i+3])/255.0))));
-		dst[i+1] = max(0,min(255,int(((number_t(src[i+1]) * greenMultiplier) + greenOffset)*(number_t(dst[i+3])/255.0))));
-		dst[i  ] = max(0,min(255,int(((number_t(src[i  ]) *   redMultiplier) +   redOffset)*(number_t(dst[i+3])/255.0))));
-	}
+	applyTransformation(src,dst,size);
 	return (uint8_t*)bm->getDataColorTransformed();
 }
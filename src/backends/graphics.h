@@ -22,9 +22,12 @@
 
 #define CHUNKSIZE_REAL 126 // 1 pixel on each side is used for clamping to edge
 #define CHUNKSIZE 128
+#define SHAPERASTERCACHE_MAX_SIZE (4*1024*1024) // maximum size in bytes of a rasterized shape that is kept for reuse by other instances
+#define SHAPERASTERCACHE_BUDGET (64*1024*1024) // maximum size in bytes of all rasterized shapes kept for reuse, the least recently used ones are dropped first
 
 #include "compat.h"
 #include <vector>
+#include <list>
 #include "swftypes.h"
 #include "threading.h"
 #include <cairo.h>
@@ -124,6 +127,8 @@ public:
 	}
 	void fillConcatenated(DisplayObject* src, bool ignoreBlendMode=false);
 	void applyTransformation(uint8_t* bm, uint32_t size);
+	// applies the transformation to size bytes of premultiplied RGBA pixels from src to dst, src and dst may be the same buffer
+	void applyTransformation(const uint8_t* src, uint8_t* dst, uint32_t size) const;
 	uint8_t* applyTransformation(BitmapContainer* bm);
 	bool isIdentity() const
 	{
@@ -336,6 +341,7 @@ public:
 	void execute() override;
 	void threadAbort() override;
 	void jobFence() override;
+	bool isUrgent() const override { return true; }
 	//ITextureUploadable interface
 	uint8_t* upload(bool refresh) override;
 	void sizeNeeded(uint32_t& w, uint32_t& h) const override;
@@ -386,6 +392,50 @@ public:
 			uint32_t height, size_t* dataSize, size_t* stride, bool frompng);
 };
 
+/*
+ * Keeps the pixels of the last rasterization of a shape definition, so that
+ * other instances of the same DefineShape drawn with identical parameters
+ * don't have to be rasterized again
+ */
+class ShapeRasterCache
+{
+private:
+	// all caches that hold pixels, most recently used first, protected by lrumutex
+	static Mutex lrumutex;
+	static std::list<ShapeRasterCache*> lru;
+	static uint64_t lrusize;
+	std::list<ShapeRasterCache*>::iterator lrupos;
+	bool inlru;
+	Mutex mutex;
+	std::vector<uint8_t, reporter_allocator<uint8_t>> buffer;
+	int32_t width;
+	int32_t height;
+	float xscale;
+	float yscale;
+	float scaleFactor;
+	number_t xstart;
+	number_t ystart;
+	ColorTransformBase colortransform;
+	SMOOTH_MODE smoothing;
+	bool softwarerenderer;
+	bool matches(int32_t _w, int32_t _h, float _xs, float _ys, float _s, number_t _xstart, number_t _ystart,
+				 const ColorTransformBase& _colortransform, SMOOTH_MODE _smoothing, bool _softwarerenderer);
+	// must be called with lrumutex locked
+	void clearIntern();
+public:
+	ShapeRasterCache(MemoryAccount* m);
+	~ShapeRasterCache();
+	/*
+	 * returns a copy of the cached pixels if they were rendered with the provided parameters, nullptr otherwise
+	 */
+	uint8_t* get(int32_t _w, int32_t _h, float _xs, float _ys, float _s, number_t _xstart, number_t _ystart,
+				 const ColorTransformBase& _colortransform, SMOOTH_MODE _smoothing, bool _softwarerenderer);
+	void put(const uint8_t* buf, uint32_t size, int32_t _w, int32_t _h, float _xs, float _ys, float _s, number_t _xstart, number_t _ystart,
+			 const ColorTransformBase& _colortransform, SMOOTH_MODE _smoothing, bool _softwarerenderer);
+	// drops the cached pixels
+	void clear();
+};
+
 class CairoTokenRenderer : public CairoRenderer
 {
 private:
@@ -406,6 +456,10 @@ private:
 	number_t xstart;
 	number_t ystart;
 	bool softwarerenderer;
+	/*
+	 * The raster cache of the DefineShape the tokens come from, if they are unmodified
+	 */
+	ShapeRasterCache* rastercache;
 public:
 	/*
 	   CairoTokenRenderer constructor
@@ -418,6 +472,7 @@ public:
 	   @param _a The alpha factor to be applied
 	   @param _ms The masks that must be applied
 	   @param _smoothing indicates if the tokens should be rendered with antialiasing
+	   @param _rastercache The raster cache shared by all instances of the same shape definition, may be nullptr
 	*/
 	CairoTokenRenderer(const tokensVector& _g, const MATRIX& _m,
 			int32_t _x, int32_t _y, int32_t _w, int32_t _h,
@@ -426,7 +481,10 @@ public:
 			bool _im, _NR<DisplayObject> _mask,
 			float _s, float _a, const std::vector<MaskData>& _ms,
 			const ColorTransformBase& _colortransform,
-			SMOOTH_MODE _smoothing,number_t _xstart, number_t _ystart, bool _softwarerenderer);
+			SMOOTH_MODE _smoothing,number_t _xstart, number_t _ystart, bool _softwarerenderer,
+			ShapeRasterCache* _rastercache=nullptr);
+	//IDrawable interface
+	uint8_t* getPixelBuffer(bool* isBufferOwner=nullptr, uint32_t* bufsize=nullptr) override;
 	/*
 	   Hit testing helper. Uses cairo to find if a point in inside the shape
 
@@ -767,6 +767,8 @@ void LocalDownloader::execute()
 		//Otherwise we follow the normal procedure
 		else {
 			std::ifstream file;
+			//Reads are done in large blocks, so let them go directly into our buffer instead of copying through the filebuf
+			file.rdbuf()->pubsetbuf(nullptr,0);
 			file.open(url.raw_buf(), std::ios::in|std::ios::binary);
 
 			if(file.is_open())
@@ -777,7 +779,7 @@ void LocalDownloader::execute()
 				}
 				file.seekg(0, std::ios::beg);
 
-				char buffer[bufSize];
+				std::vector<char> buffer(bufSize);
 
 				bool readFailed = 0;
 				while(!file.eof())
@@ -787,8 +789,8 @@ void LocalDownloader::execute()
 						readFailed = 1;
 						break;
 					}
-					file.read(buffer, bufSize);
-					append((uint8_t *) buffer, file.gcount());
+					file.read(buffer.data(), bufSize);
+					append((uint8_t *) buffer.data(), file.gcount());
 				}
 				if(readFailed)
 				{
@@ -214,8 +214,9 @@ private:
 	void execute();
 	void threadAbort();
 	
-	//Size of the reading buffer
-	static const size_t bufSize = 8192;
+	//Size of the reading buffer. Local files are read in large blocks,
+	//as every block results in a wakeup of the main loop and a progress notification
+	static const size_t bufSize = 256*1024;
 public:
 	LocalDownloader(const tiny_string& _url, _R<StreamCache> _cache, ILoadable* o, bool dataGeneration = false);
 };
@@ -60,7 +60,7 @@ RenderThread::RenderThread(SystemState* s):GLRenderContext(),
 	m_sys(s),status(CREATED),
 	prevUploadJob(nullptr),
 	renderNeeded(false),uploadNeeded(false),resizeNeeded(false),newTextureNeeded(false),event(0),newWidth(0),newHeight(0),scaleX(1),scaleY(1),
-	offsetX(0),offsetY(0),tempBufferAcquired(false),frameCount(0),secsCount(0),initialized(0),refreshNeeded(false),screenshotneeded(false),inSettings(false),canrender(false),
+	offsetX(0),offsetY(0),tempBufferAcquired(false),frameCount(0),secsCount(0),initialized(0),refreshNeeded(false),stageChanged(true),settingsRendered(false),screenshotneeded(false),inSettings(false),canrender(false),
 	cairoTextureContextSettings(nullptr),cairoTextureContext(nullptr)
 {
 	LOG(LOG_INFO,"RenderThread this=" << this);
@@ -215,15 +215,22 @@ bool RenderThread::doRender(ThreadProfile* profile,Chronometer* chronometer)
 		LOG(LOG_INFO,"Window resized to " << windowWidth << 'x' << windowHeight);
 		commonGLResize();
 		m_sys->resizeCompleted();
+		stageChanged=true;
 		if (profile && chronometer)
 			profile->accountTime(chronometer->checkpoint());
 		return true;
 	}
 	if(newTextureNeeded)
+	{
 		handleNewTexture();
+		stageChanged=true;
+	}
 
 	if(prevUploadJob)
+	{
 		finalizeUpload();
+		stageChanged=true;
+	}
 	if (refreshNeeded)
 	{
 		Locker l(mutexRefreshSurfaces);
@@ -236,6 +243,7 @@ bool RenderThread::doRender(ThreadProfile* profile,Chronometer* chronometer)
 		}
 		refreshNeeded=false;
 		renderNeeded=true;
+		stageChanged=true;
 	}
 
 	if(uploadNeeded)
@@ -282,6 +290,17 @@ bool RenderThread::doRender(ThreadProfile* profile,Chronometer* chronometer)
 				renderNeeded=false;
 				return true;
 			}
+			if(!stageChanged && !inSettings && !settingsRendered && !screenshotneeded && !m_sys->showProfilingData)
+			{
+				// nothing has changed since the last frame, so we keep the current frame
+				if (profile && chronometer)
+					profile->accountTime(chronometer->checkpoint());
+				canrender=false;
+				renderNeeded=false;
+				return true;
+			}
+			// reset before rendering, so changes made during rendering lead to another render
+			stageChanged=false;
 			if(!m_sys->isOnError())
 			{
 				coreRendering();
@@ -290,6 +309,7 @@ bool RenderThread::doRender(ThreadProfile* profile,Chronometer* chronometer)
 			}
 		}
 	}
+	settingsRendered=inSettings;
 	if (inSettings)
 		renderSettingsPage();
 	if (screenshotneeded)
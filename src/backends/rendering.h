@@ -92,6 +92,10 @@ private:
 	void plotProfilingData();
 	Semaphore initialized;
 	volatile bool refreshNeeded;
+	// set if anything on the stage may look different since the last rendered frame
+	volatile bool stageChanged;
+	// true if the settings page was shown in the last rendered frame
+	bool settingsRendered;
 	Mutex mutexRefreshSurfaces;
 	struct refreshableSurface
 	{
@@ -116,6 +120,10 @@ public:
 	void stop();
 	void wait();
 	void draw(bool force);
+	/*
+	   Notifies the render thread that the stage has to be rendered again on the next frame
+	*/
+	void setStageChanged() { stageChanged=true; }
 
 	void init();
 	void deinit();
@@ -131,7 +131,16 @@ void GLRenderContext::renderTextured(const TextureChunk& chunk, float alpha, COL
 									 bool isMask, bool hasMask, float directMode, RGB directColor, SMOOTH_MODE smooth, const MATRIX& matrix, Rectangle* scalingGrid,
 									 AS_BLENDMODE blendmode)
 {
-	engineData->exec_glUniform1f(blendModeUniform, blendmode == BLENDMODE_NORMAL ? this->currentShaderBlendMode : BLENDMODE_NORMAL);
+	AS_BLENDMODE shaderblendmode = blendmode == BLENDMODE_NORMAL ? this->currentShaderBlendMode : BLENDMODE_NORMAL;
+	if (!isMask && colorMode == RGB_MODE && directMode == 0.0
+			&& shaderblendmode != BLENDMODE_OVERLAY && shaderblendmode != BLENDMODE_HARDLIGHT
+			&& alpha*colortransform.alphaMultiplier <= 0 && colortransform.alphaOffset <= 0)
+	{
+		// the shader produces fully transparent pixels that leave the destination unchanged for all non-shader blend modes,
+		// so we can skip all state changes and the draw call
+		return;
+	}
+	engineData->exec_glUniform1f(blendModeUniform, shaderblendmode);
 	switch (blendmode)
 	{
 		case BLENDMODE_NORMAL:
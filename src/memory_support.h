@@ -90,6 +90,19 @@ public:
 		th->memoryAccount->removeBytes(th->objSize);
 		free(th);
 	}
+	/*
+	 * Moves the bytes of an object allocated by operator new to another account.
+	 * obj must point to the start of the allocated object
+	 */
+	static void setMemoryAccount(void* obj, MemoryAccount* m)
+	{
+		objData* th=reinterpret_cast<objData*>(obj)-1;
+		if(!m)
+			m = getUnaccountedMemoryAccount();
+		th->memoryAccount->removeBytes(th->objSize);
+		m->addBytes(th->objSize);
+		th->memoryAccount = m;
+	}
 };
 
 template<class T>
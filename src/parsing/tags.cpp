@@ -62,6 +62,34 @@
 using namespace std;
 using namespace lightspark;
 
+/*
+ * Inflates the zlib compressed data of a tag directly into the destination buffer,
+ * without going through the 4K chunks of zlib_filter.
+ * Any part of the destination that is not covered by the compressed data is cleared.
+ * Returns the number of uncompressed bytes written
+ */
+static size_t inflateTagData(const uint8_t* in, size_t insize, uint8_t* out, size_t outsize)
+{
+	z_stream strm;
+	strm.zalloc = Z_NULL;
+	strm.zfree = Z_NULL;
+	strm.opaque = Z_NULL;
+	strm.next_in = (Bytef*)in;
+	strm.avail_in = insize;
+	if (inflateInit(&strm) != Z_OK)
+		throw RunTimeException("Failed to initialize ZLib");
+	strm.next_out = out;
+	strm.avail_out = outsize;
+	int ret = inflate(&strm, Z_FINISH);
+	if (ret != Z_STREAM_END && ret != Z_OK && ret != Z_BUF_ERROR)
+		LOG(LOG_ERROR,"zlib error while uncompressing tag data:"<<ret);
+	size_t written = outsize-strm.avail_out;
+	inflateEnd(&strm);
+	if (written < outsize)
+		memset(out+written,0,outsize-written);
+	return written;
+}
+
 uint8_t* JPEGTablesTag::JPEGTables = nullptr;
 int JPEGTablesTag::tableSize = 0;
 
@@ -1339,17 +1367,16 @@ DefineBitsLosslessTag::DefineBitsLosslessTag(RECORDHEADER h, istream& in, int ve
 	size_t cSize = dest-in.tellg(); //rest of this tag
 	cData.resize(cSize);
 	in.read(&cData[0], cSize);
-	istringstream cDataStream(cData);
-	zlib_filter zf(cDataStream.rdbuf());
-	istream zfstream(&zf);
 
 	if (BitmapFormat == LOSSLESS_BITMAP_RGB15 ||
 	    BitmapFormat == LOSSLESS_BITMAP_RGB24)
 	{
 		size_t size = BitmapWidth * BitmapHeight * 4;
 		uint8_t* inData=new(nothrow) uint8_t[size];
-		zfstream.read((char*)inData,size);
-		assert(!zfstream.fail() && !zfstream.eof());
+		// RGB15 rows are 2 bytes per pixel and 32 bit aligned
+		size_t expectedsize = BitmapFormat == LOSSLESS_BITMAP_RGB15 ? ((BitmapWidth*2+3)&~3u)*BitmapHeight : size;
+		if (inflateTagData((const uint8_t*)cData.data(),cSize,inData,size) < expectedsize)
+			LOG(LOG_ERROR, "Bitmap data in DefineBitsLossless is incomplete");
 
 		BitmapContainer::BITMAP_FORMAT format;
 		if (BitmapFormat == LOSSLESS_BITMAP_RGB15)
@@ -1378,8 +1405,8 @@ DefineBitsLosslessTag::DefineBitsLosslessTag(RECORDHEADER h, istream& in, int ve
 
 		size_t size = paletteBPP*numColors + stride*BitmapHeight;
 		uint8_t* inData=new(nothrow) uint8_t[size];
-		zfstream.read((char*)inData,size);
-		assert(!zfstream.fail() && !zfstream.eof());
+		if (inflateTagData((const uint8_t*)cData.data(),cSize,inData,size) < size)
+			LOG(LOG_ERROR, "Palette bitmap data in DefineBitsLossless is incomplete");
 
 		uint8_t *palette = inData;
 		uint8_t *pixelData = inData + paletteBPP*numColors;
@@ -1546,11 +1573,11 @@ void DefineTextTag::computeCached()
 	}
 }
 
-DefineShapeTag::DefineShapeTag(RECORDHEADER h,int v,RootMovieClip* root):DictionaryTag(h,root),Shapes(v),tokens(nullptr)
+DefineShapeTag::DefineShapeTag(RECORDHEADER h,int v,RootMovieClip* root):DictionaryTag(h,root),Shapes(v),tokens(nullptr),rastercache(root->getSystemState()->tagsMemory),instancecount(0)
 {
 }
 
-DefineShapeTag::DefineShapeTag(RECORDHEADER h, std::istream& in,RootMovieClip* root):DictionaryTag(h,root),Shapes(1),tokens(nullptr)
+DefineShapeTag::DefineShapeTag(RECORDHEADER h, std::istream& in,RootMovieClip* root):DictionaryTag(h,root),Shapes(1),tokens(nullptr),rastercache(root->getSystemState()->tagsMemory),instancecount(0)
 {
 	LOG(LOG_TRACE,"DefineShapeTag");
 	in >> ShapeId >> ShapeBounds >> Shapes;
@@ -2880,27 +2907,14 @@ DefineBitsJPEG3Tag::DefineBitsJPEG3Tag(RECORDHEADER h, std::istream& in, RootMov
 	int alphaSize=Header.getLength()-dataSize-6;
 	if(alphaSize>0) //If less that 0 the consistency check on tag size will stop later
 	{
-		//Create a zlib filter
 		string alphaData;
 		alphaData.resize(alphaSize);
 		in.read(&alphaData[0], alphaSize);
-		istringstream alphaStream(alphaData);
-		zlib_filter zf(alphaStream.rdbuf());
-		istream zfstream(&zf);
-		zfstream.exceptions ( istream::eofbit | istream::failbit | istream::badbit );
 
-		vector<char> alphaDataUncompressed;
+		vector<uint8_t> alphaDataUncompressed;
 		alphaDataUncompressed.resize(bitmap->getHeight()*bitmap->getWidth());
-		
-		//Catch the exception if the stream ends
-		try
-		{
-			zfstream.read(alphaDataUncompressed.data(),bitmap->getHeight()*bitmap->getWidth());
-		}
-		catch(std::exception& e)
-		{
-			LOG(LOG_ERROR, "Exception while parsing Alpha data in DefineBitsJPEG3");
-		}
+		if (inflateTagData((const uint8_t*)alphaData.data(),alphaSize,alphaDataUncompressed.data(),alphaDataUncompressed.size()) < alphaDataUncompressed.size())
+			LOG(LOG_ERROR, "Alpha data in DefineBitsJPEG3 is incomplete");
 		uint8_t* d = bitmap->getData();
 		//Set alpha
 		for(int32_t i=0;i<bitmap->getHeight()*bitmap->getWidth();i++)
@@ -150,6 +150,9 @@ protected:
 	SHAPEWITHSTYLE Shapes;
 	tokensVector* tokens;
 	TextureChunk chunk;
+	// pixels shared between the instances of this shape, only used if there is more than one instance
+	ShapeRasterCache rastercache;
+	uint32_t instancecount;
 	DefineShapeTag(RECORDHEADER h,int v,RootMovieClip* root);
 public:
 	DefineShapeTag(RECORDHEADER h,std::istream& in, RootMovieClip* root);
@@ -35,6 +35,7 @@
 #include "flash/utils/ByteArray.h"
 #include <glib/gstdio.h>
 #include <fcntl.h>
+#include <cmath>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -1422,6 +1423,20 @@ void EngineData::exec_glStencilFunc_GL_ALWAYS()
 	glStencilFunc(GL_ALWAYS, 0, 0xff);
 }
 
+static inline float clampAudioSample(float v)
+{
+	// NaN would pass through any min/max clamp, so it is mixed as silence
+	if (std::isnan(v))
+		return 0.0f;
+	const float max_audioval = 3.402823466e+38F;
+	const float min_audioval = -3.402823466e+38F;
+	if (v > max_audioval)
+		return max_audioval;
+	if (v < min_audioval)
+		return min_audioval;
+	return v;
+}
+
 void audioCallback(void * userdata, uint8_t * stream, int len)
 {
 	AudioManager* manager = (AudioManager*)userdata;
@@ -1430,48 +1445,39 @@ void audioCallback(void * userdata, uint8_t * stream, int len)
 
 	{
 		Locker l(manager->streamMutex);
+		if (manager->mixbuffer.size() < (size_t)len)
+			manager->mixbuffer.resize(len);
+		uint8_t* buf = manager->mixbuffer.data();
 		for (auto it = manager->streams.begin(); it != manager->streams.end(); it++)
 		{
 			AudioStream* s = (*it);
 			if (s->ispaused())
 				continue;
 			s->startMixing();
-			const float fmaxvolume = 1.0f / ((float)SDL_MIX_MAXVOLUME);
-			const float fvolume = (float)s->getVolume()*(float)SDL_MIX_MAXVOLUME;
+			// volume and panning are constant during one callback, so compute the gain of both channels only once
+			const float fvolume = (float)s->getVolume();
+			const float leftgain = fvolume * s->getPanning()[0];
+			const float rightgain = fvolume * s->getPanning()[1];
 			uint32_t readcount = 0;
-			uint8_t* buf = new uint8_t[len];
 			while (readcount < ((uint32_t)len))
 			{
 				uint32_t ret = s->getDecoder()->copyFrameF32((float *)(buf+readcount), ((uint32_t)len)-readcount);
 				if (!ret)
 					break;
-				float* src32=(float *)(buf+readcount);
+				const float* src32=(const float *)(buf+readcount);
 				float* dst32=(float *)(stream+readcount);
 				readcount += ret;
 
-				float src1, src2;
-				double dst_sample;
-
-				const double max_audioval = 3.402823466e+38F;
-				const double min_audioval = -3.402823466e+38F;
-				int curpanning=0;
-				while (ret)
+				uint32_t samples = ret/4;
+				uint32_t i = 0;
+				for (; i+1 < samples; i+=2)
 				{
-					src1 = *src32 * fvolume * fmaxvolume * s->getPanning()[curpanning];
-					curpanning = 1-curpanning;
-					src2 = *dst32;
-					src32++;
-					dst_sample = ((double)src1) + ((double)src2);
-					if (dst_sample > max_audioval) {
-						dst_sample = max_audioval;
-					} else if (dst_sample < min_audioval) {
-						dst_sample = min_audioval;
-					}
-					*(dst32++) = (float)dst_sample;
-					ret-=4;
+					dst32[i] = clampAudioSample(dst32[i]+src32[i]*leftgain);
+					dst32[i+1] = clampAudioSample(dst32[i+1]+src32[i+1]*rightgain);
 				}
+				if (i < samples)
+					dst32[i] = clampAudioSample(dst32[i]+src32[i]*leftgain);
 			}
-			delete[] buf;
 		}
     }
 }
@@ -23,17 +23,35 @@
 void lightspark::fastYUV420ChannelsToYUV0Buffer(uint8_t* y, uint8_t* u, uint8_t* v, uint8_t* out, uint32_t width, uint32_t height)
 {
 	uint32_t texw= (width+15)&0xfffffff0;
+	uint32_t halfwidth=width/2;
 	for(uint32_t i=0;i<height;i++)
 	{
-		for(uint32_t j=0;j<width;j++)
+		// work on row pointers to keep the index arithmetic out of the inner loop
+		const uint8_t* yrow=y+i*width;
+		const uint8_t* urow=u+(i/2)*halfwidth;
+		const uint8_t* vrow=v+(i/2)*halfwidth;
+		uint8_t* outrow=out+i*texw*4;
+		uint32_t j=0;
+		// two horizontal pixels share the same chroma samples
+		for(;j+1<width;j+=2)
 		{
-			uint32_t pixelCoordFull=i*texw+j;
-			uint32_t pixelCoordHalf=(i/2)*(width/2)+(j/2);
-			out[pixelCoordFull*4+0]=y[i*width+j];
-			out[pixelCoordFull*4+1]=u[pixelCoordHalf];
-			out[pixelCoordFull*4+2]=v[pixelCoordHalf];
-			out[pixelCoordFull*4+3]=0xff;
+			uint8_t cu=urow[j/2];
+			uint8_t cv=vrow[j/2];
+			outrow[j*4+0]=yrow[j];
+			outrow[j*4+1]=cu;
+			outrow[j*4+2]=cv;
+			outrow[j*4+3]=0xff;
+			outrow[j*4+4]=yrow[j+1];
+			outrow[j*4+5]=cu;
+			outrow[j*4+6]=cv;
+			outrow[j*4+7]=0xff;
+		}
+		if(j<width)
+		{
+			outrow[j*4+0]=yrow[j];
+			outrow[j*4+1]=urow[j/2];
+			outrow[j*4+2]=vrow[j/2];
+			outrow[j*4+3]=0xff;
 		}
 	}
 }
-
@@ -548,6 +548,26 @@ multiname* ABCContext::getMultinameImpl(asAtom& n, ASObject* n2, unsigned int mi
 	}
 	return ret;
 }
+// atoms for the values of the pushbyte and pushshort opcodes, they are the same for all ABCContexts
+struct smallintegeratoms
+{
+	asAtom bytes[0x100];
+	asAtom shorts[0x10000];
+	smallintegeratoms()
+	{
+		for (int32_t i = 0; i < 0x100; i++)
+			bytes[i] = asAtomHandler::fromInt((int32_t)(int8_t)i);
+		for (int32_t i = 0; i < 0x10000; i++)
+			shorts[i] = asAtomHandler::fromInt((int32_t)(int16_t)i);
+	}
+};
+static smallintegeratoms& getSmallIntegerAtoms()
+{
+	// initialization of local statics is thread safe, contexts may be created in several parser threads
+	static smallintegeratoms atoms;
+	return atoms;
+}
+
 ABCContext::ABCContext(RootMovieClip* r, istream& in, ABCVm* vm):scriptsdeclared(false),root(r),constant_pool(vm->vmDataMemory),
 	methods(reporter_allocator<method_info>(vm->vmDataMemory)),
 	metadata(reporter_allocator<metadata_info>(vm->vmDataMemory)),
@@ -594,12 +614,8 @@ ABCContext::ABCContext(RootMovieClip* r, istream& in, ABCVm* vm):scriptsdeclared
 		res->setRefConstant();
 		constantAtoms_namespaces[i] = asAtomHandler::fromObject(res);
 	}
-	constantAtoms_byte.resize(0x100);
-	for (uint32_t i = 0; i < 0x100; i++)
-		constantAtoms_byte[i] = asAtomHandler::fromInt((int32_t)(int8_t)i);
-	constantAtoms_short.resize(0x10000);
-	for (int32_t i = 0; i < 0x10000; i++)
-		constantAtoms_short[i] = asAtomHandler::fromInt((int32_t)(int16_t)i);
+	constantAtoms_byte = getSmallIntegerAtoms().bytes;
+	constantAtoms_short = getSmallIntegerAtoms().shorts;
 	atomsCachedMaxID=0;
 	
 	namespaceBaseId=vm->getAndIncreaseNamespaceBase(constant_pool.namespaces.size());
@@ -1163,6 +1179,7 @@ void ABCVm::handleEvent(std::pair<_NR<EventDispatcher>, _R<Event> > e)
 						events_queue.push_back(idleevents_queue.front());
 						idleevents_queue.pop_front();
 					}
+					idleevents_index.clear();
 					isIdle = true;
 #ifndef NDEBUG
 //					if (getEventQueueSize() == 0)
@@ -1236,11 +1253,14 @@ bool ABCVm::prependEvent(_NR<EventDispatcher> obj ,_R<Event> ev, bool force)
 	if (!obj.isNull())
 		obj->onNewEvent(ev.getPtr());
 
+	// the vm thread only waits for the condition if the queue is empty
+	bool wasempty = events_queue.empty();
 	if (isIdle || force)
 		events_queue.push_front(pair<_NR<EventDispatcher>,_R<Event>>(obj, ev));
 	else
 		events_queue.push_back(pair<_NR<EventDispatcher>,_R<Event>>(obj, ev));
-	sem_event_cond.signal();
+	if (wasempty)
+		sem_event_cond.signal();
 	return true;
 }
 
@@ -1280,9 +1300,11 @@ bool ABCVm::addEvent(_NR<EventDispatcher> obj ,_R<Event> ev, bool isGlobalMessag
 	}
 	if (!obj.isNull())
 		obj->onNewEvent(ev.getPtr());
+	bool wasempty = events_queue.empty();
 	events_queue.push_back(pair<_NR<EventDispatcher>,_R<Event>>(obj, ev));
 	RELEASE_WRITE(ev->queued,true);
-	sem_event_cond.signal();
+	if (wasempty)
+		sem_event_cond.signal();
 	if (isGlobalMessage)
 	{
 		m_sys->addEventToBackgroundWorkers(obj,ev);
@@ -1301,20 +1323,16 @@ bool ABCVm::addIdleEvent(_NR<EventDispatcher> obj ,_R<Event> ev, bool removeprev
 	}
 	if (!obj.isNull() && ev->getInstanceWorker() && !ev->getInstanceWorker()->isPrimordial)
 		return ev->getInstanceWorker()->addEvent(obj,ev);
-	if (removeprevious) 
+	idleEventKey key = make_pair((const EventDispatcher*)obj.getPtr(),m_sys->getUniqueStringId(ev->type));
+	auto itindex = idleevents_index.find(key);
+	if (removeprevious && itindex != idleevents_index.end())
 	{
-		for (auto it = idleevents_queue.begin(); it != idleevents_queue.end(); it++)
-		{
-			// if an idle event with the same dispatcher and same type was added previously, it is removed
-			// this avoids flooding the event queue with too many "similar" events (e.g. mouseMove)
-			if ((*it).first == obj && (*it).second->type == ev->type)
-			{
-				idleevents_queue.erase(it);
-				break;
-			}
-		}
+		// if an idle event with the same dispatcher and same type was added previously, it is removed
+		// this avoids flooding the event queue with too many "similar" events (e.g. mouseMove)
+		idleevents_queue.erase(itindex->second);
 	}
 	idleevents_queue.push_back(pair<_NR<EventDispatcher>,_R<Event>>(obj, ev));
+	idleevents_index[key] = prev(idleevents_queue.end());
 	RELEASE_WRITE(ev->queued,true);
 	return true;
 }
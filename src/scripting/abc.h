@@ -27,6 +27,7 @@
 #include <deque>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include "swf.h"
 #include "scripting/abcutils.h"
 #include "scripting/abctypes.h"
@@ -242,8 +243,8 @@ public:
 	std::vector<asAtom> constantAtoms_doubles;
 	std::vector<asAtom> constantAtoms_strings;
 	std::vector<asAtom> constantAtoms_namespaces;
-	std::vector<asAtom> constantAtoms_byte;
-	std::vector<asAtom> constantAtoms_short;
+	asAtom* constantAtoms_byte;
+	asAtom* constantAtoms_short;
 	std::unordered_map<uint32_t,asAtom> constantAtoms_cached;
 	ATOMIC_INT32(atomsCachedMaxID);
 	uint32_t addCachedConstantAtom(asAtom a);
@@ -546,6 +547,16 @@ private:
 	typedef std::pair<_NR<EventDispatcher>,_R<Event>> eventType;
 	std::deque<eventType, reporter_allocator<eventType>> events_queue;
 	std::list<eventType, reporter_allocator<eventType>> idleevents_queue;
+	// last idle event for each dispatcher and event type (as unique string id), used to replace "similar" events in constant time
+	typedef std::pair<const EventDispatcher*,uint32_t> idleEventKey;
+	struct idleEventKeyHash
+	{
+		size_t operator()(const idleEventKey& k) const
+		{
+			return std::hash<const EventDispatcher*>()(k.first) ^ (std::hash<uint32_t>()(k.second)<<1);
+		}
+	};
+	std::unordered_map<idleEventKey,std::list<eventType, reporter_allocator<eventType>>::iterator,idleEventKeyHash> idleevents_index;
 	void handleEvent(std::pair<_NR<EventDispatcher>,_R<Event> > e);
 	void handleFrontEvent();
 	void signalEventWaiters();
@@ -128,7 +128,8 @@ void ABCVm::executeFunction(call_context* context)
 #endif
 
 	asAtom* ret = &context->locals[context->mi->body->getReturnValuePos()];
-	while(asAtomHandler::isInvalid(*ret) && !context->exceptionthrown)
+	// the return value and the exception are checked with a single branch, as this is executed for every instruction
+	while(!(ret->uintval | (LIGHTSPARK_ATOM_VALTYPE)context->exceptionthrown))
 	{
 #ifdef PROFILING_SUPPORT
 		uint32_t instructionPointer=context->exec_pos- &context->mi->body->preloadedcode.front();
@@ -1132,7 +1133,8 @@ struct preloadedcodebuffer
 struct preloadstate
 {
 	std::vector<operands> operandlist;
-	std::map<int32_t,int32_t> oldnewpositions;
+	// only used for lookups, so no ordering needed
+	std::unordered_map<int32_t,int32_t> oldnewpositions;
 	std::map<int32_t,int32_t> jumptargets;
 	// result type from the top of the typestack at start of jump
 	std::map<int32_t,Class_base*> jumptargeteresulttypes;
@@ -3305,6 +3307,10 @@ void ABCVm::preloadFunction(SyntheticFunction* function, ASWorker* wrk)
 
 	const int code_len=mi->body->code.size();
 	preloadstate state(function,wrk);
+	// every abc opcode takes at least one byte and the optimizer mostly merges opcodes,
+	// so the code length is a good upper bound for the size of the preloaded code
+	state.preloadedcode.reserve(code_len);
+	state.oldnewpositions.reserve(code_len+2);
 	std::map<int32_t,int32_t> jumppositions;
 	std::map<int32_t,int32_t> jumpstartpositions;
 	std::map<int32_t,int32_t> switchpositions;
@@ -8061,6 +8067,7 @@ void ABCVm::preloadFunction(SyntheticFunction* function, ASWorker* wrk)
 		itexc++;
 	}
 	assert(mi->body->preloadedcode.size()==0);
+	mi->body->preloadedcode.reserve(state.preloadedcode.size());
 	for (auto itc = state.preloadedcode.begin(); itc != state.preloadedcode.end(); itc++)
 	{
 		mi->body->preloadedcode.push_back((*itc).pcode);
@@ -95,13 +95,7 @@ uint8_t* BitmapContainer::applyColorTransform(number_t redMulti, number_t greenM
 	uint8_t* src = getData();
 	uint8_t* dst = getDataColorTransformed();
 	uint32_t size = getWidth()*getHeight()*4;
-	for (uint32_t i = 0; i < size; i+=4)
-	{
-		dst[i+3] = max(0,min(255,int(((number_t(src[i+3]) * currentcolortransform.alphaMultiplier) + currentcolortransform.alphaOffset))));
-		dst[i+2] = max(0,min(255,int(((number_t(src[i+2]) * currentcolortransform. blueMultiplier) + currentcolortransform. blueOffset)*(number_t(dst[i+3])/255.0))));
-		dst[i+1] = max(0,min(255,int(((number_t(src[i+1]) * currentcolortransform.greenMultiplier) + currentcolortransform.greenOffset)*(number_t(dst[i+3])/255.0))));
-		dst[i  ] = max(0,min(255,int(((number_t(src[i  ]) * currentcolortransform.  redMultiplier) + currentcolortransform.  redOffset)*(number_t(dst[i+3])/255.0))));
-	}
+	currentcolortransform.applyTransformation(src,dst,size);
 	return getDataColorTransformed();
 }
 
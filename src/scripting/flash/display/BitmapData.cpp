@@ -255,6 +255,17 @@ void BitmapData::drawDisplayObject(DisplayObject* d, const MATRIX& initialMatrix
 			continue;
 		if (forCachedBitmap && !target->isMask())
 			target->hasChanged=false;
+		//Objects completely outside of the bitmap don't have to be rasterized at all
+		//Masks are always rasterized, as they are used by other objects
+		if (!drawable->getIsMask() && !target->isMask()
+			&& (drawable->getXOffsetTransformed() >= pixels->getWidth()
+				|| drawable->getYOffsetTransformed() >= pixels->getHeight()
+				|| drawable->getXOffsetTransformed()+drawable->getWidthTransformed() <= 0
+				|| drawable->getYOffsetTransformed()+drawable->getHeightTransformed() <= 0))
+		{
+			delete drawable;
+			continue;
+		}
 		//Compute the matrix for this object
 		bool isBufferOwner=true;
 		uint32_t bufsize=0;
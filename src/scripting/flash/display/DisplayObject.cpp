@@ -344,7 +344,7 @@ void DisplayObject::sinit(Class_base* c)
 
 ASFUNCTIONBODY_GETTER_SETTER_STRINGID(DisplayObject,name)
 ASFUNCTIONBODY_GETTER_SETTER(DisplayObject,accessibilityProperties)
-ASFUNCTIONBODY_GETTER_SETTER(DisplayObject,scrollRect)
+ASFUNCTIONBODY_GETTER_SETTER_CB(DisplayObject,scrollRect,onScrollRect)
 ASFUNCTIONBODY_GETTER_SETTER_NOT_IMPLEMENTED(DisplayObject, rotationX)
 ASFUNCTIONBODY_GETTER_SETTER_NOT_IMPLEMENTED(DisplayObject, rotationY)
 ASFUNCTIONBODY_GETTER_SETTER_NOT_IMPLEMENTED(DisplayObject, opaqueBackground)
@@ -510,6 +510,8 @@ ASFUNCTIONBODY_ATOM(DisplayObject,_setTransform)
 		th->setMatrix(trans->owner->matrix);
 		th->colorTransform = trans->owner->colorTransform;
 		th->hasChanged=true;
+		if (th->isOnStage())
+			th->requestInvalidation(wrk->getSystemState());
 	}
 }
 
@@ -659,6 +661,13 @@ void DisplayObject::setFilters(const FILTERLIST& filterlist)
 	
 }
 
+void DisplayObject::onScrollRect(_NR<Rectangle> oldValue)
+{
+	hasChanged=true;
+	if(onStage)
+		requestInvalidation(getSystemState());
+}
+
 void DisplayObject::setMask(_NR<DisplayObject> m)
 {
 	bool mustInvalidate=(mask!=m || (m && m->hasChanged)) && onStage;
@@ -685,12 +694,19 @@ void DisplayObject::setMask(_NR<DisplayObject> m)
 }
 void DisplayObject::setBlendMode(UI8 blendmode)
 {
+	AS_BLENDMODE oldblendmode = this->blendMode;
 	if (blendmode <= 1 || blendmode > 14)
 		this->blendMode = BLENDMODE_NORMAL;
 	else
 	{
 		this->blendMode = (AS_BLENDMODE)(uint8_t)blendmode;
 	}
+	if (this->blendMode != oldblendmode)
+	{
+		hasChanged=true;
+		if(onStage)
+			requestInvalidation(getSystemState());
+	}
 }
 
 bool DisplayObject::isShaderBlendMode(AS_BLENDMODE bl)
@@ -907,6 +923,8 @@ IDrawable* DisplayObject::invalidate(DisplayObject* target, const MATRIX& initia
 
 void DisplayObject::requestInvalidation(InvalidateQueue* q, bool forceTextureRefresh)
 {
+	// objects that don't add themselves to the invalidate queue still need the next frame to be rendered
+	getSystemState()->signalStageChanged();
 	//Let's invalidate also the mask
 	if(!mask.isNull())
 		mask->requestInvalidation(q);
@@ -1442,7 +1460,9 @@ ASFUNCTIONBODY_ATOM(DisplayObject,_setBlendMode)
 
 	if (th->computeCacheAsBitmap() && !th->cachedAsBitmapOf && th->is<DisplayObjectContainer>())
 		th->as<DisplayObjectContainer>()->setChildrenCachedAsBitmapOf(th);
-	
+	th->hasChanged=true;
+	if (th->isOnStage())
+		th->requestInvalidation(wrk->getSystemState());
 }
 
 ASFUNCTIONBODY_ATOM(DisplayObject,localToGlobal)
@@ -162,6 +162,7 @@ public:
 	_NR<LoaderInfo> loaderInfo;
 	ASPROPERTY_GETTER_SETTER(_NR<Array>,filters);
 	ASPROPERTY_GETTER_SETTER(_NR<Rectangle>,scrollRect);
+	void onScrollRect(_NR<Rectangle> oldValue);
 	_NR<ColorTransform> colorTransform;
 	// pointer to the ancestor of this DisplayObject that is cached as Bitmap
 	DisplayObject* cachedAsBitmapOf;
@@ -1355,11 +1355,13 @@ _NR<DisplayObject> DisplayObjectContainer::hitTestImpl(number_t x, number_t y, D
 		if((*j)->isMask())
 			continue;
 
-		if(!(*j)->getMatrix().isInvertible())
+		// getMatrix() has to rebuild the matrix from scale, rotation and translation, so we only compute it once per child
+		const MATRIX childmatrix = (*j)->getMatrix();
+		if(!childmatrix.isInvertible())
 			continue; /* The object is shrunk to zero size */
 
 		number_t localX, localY;
-		(*j)->getMatrix().getInverted().multiply2D(x,y,localX,localY);
+		childmatrix.getInverted().multiply2D(x,y,localX,localY);
 		ret=(*j)->hitTest(localX,localY,type,interactiveObjectsOnly);
 		
 		if (!ret.isNull())
@@ -3361,6 +3363,7 @@ void DisplayObjectContainer::_addChildAt(DisplayObject* child, unsigned int inde
 		}
 		child->addStoredMember();
 	}
+	getSystemState()->signalStageChanged();
 	if (!onStage || child != getSystemState()->mainClip)
 		child->setOnStage(onStage,false,inskipping);
 	if (computeCacheAsBitmap())
@@ -3408,6 +3411,7 @@ bool DisplayObjectContainer::_removeChild(DisplayObject* child,bool direct,bool
 		}
 		dynamicDisplayList.erase(it);
 	}
+	getSystemState()->signalStageChanged();
 	if (!keeponstage)
 		child->setOnStage(false,false,inskipping);
 	child->setParent(nullptr);
@@ -3438,6 +3442,7 @@ void DisplayObjectContainer::_removeAllChildren()
 		it = dynamicDisplayList.erase(it);
 		child->removeStoredMember();
 	}
+	getSystemState()->signalStageChanged();
 }
 
 void DisplayObjectContainer::removeAVM1Listeners()
@@ -3610,6 +3615,7 @@ ASFUNCTIONBODY_ATOM(DisplayObjectContainer,removeChildren)
 		}
 		th->dynamicDisplayList.erase(th->dynamicDisplayList.begin()+beginindex,th->dynamicDisplayList.begin()+endindex);
 	}
+	wrk->getSystemState()->signalStageChanged();
 }
 ASFUNCTIONBODY_ATOM(DisplayObjectContainer,_setChildIndex)
 {
@@ -3634,6 +3640,7 @@ ASFUNCTIONBODY_ATOM(DisplayObjectContainer,_setChildIndex)
 	}
 	auto itrem = th->dynamicDisplayList.begin()+curIndex;
 	th->dynamicDisplayList.erase(itrem); //remove from old position
+	wrk->getSystemState()->signalStageChanged();
 
 	auto it=th->dynamicDisplayList.begin();
 	int i = 0;
@@ -3678,6 +3685,7 @@ ASFUNCTIONBODY_ATOM(DisplayObjectContainer,swapChildren)
 
 		std::iter_swap(it1, it2);
 	}
+	wrk->getSystemState()->signalStageChanged();
 }
 
 ASFUNCTIONBODY_ATOM(DisplayObjectContainer,swapChildrenAt)
@@ -3702,6 +3710,7 @@ ASFUNCTIONBODY_ATOM(DisplayObjectContainer,swapChildrenAt)
 		Locker l(th->mutexDisplayList);
 		std::iter_swap(th->dynamicDisplayList.begin() + index1, th->dynamicDisplayList.begin() + index2);
 	}
+	wrk->getSystemState()->signalStageChanged();
 }
 
 //Only from VM context
@@ -3874,7 +3883,9 @@ void Shape::setupShape(DefineShapeTag* tag, float _scaling)
 	tokens.stroketokens.assign(tag->tokens->stroketokens.begin(),tag->tokens->stroketokens.end());
 	tokens.canRenderToGL = tag->tokens->canRenderToGL;
 	tokens.boundsRect = tag->tokens->boundsRect;
+	resetFromTag();
 	fromTag = tag;
+	tag->instancecount++;
 	// TODO caching of texture currently doesn't work if the DefineShapeTag is used by multiple shape objects with different scaling
 //	cachedSurface.isChunkOwner=false;
 //	cachedSurface.tex=&tag->chunk;
@@ -3888,10 +3899,22 @@ uint32_t Shape::getTagID() const
 	return fromTag ? fromTag->getId() : UINT32_MAX; 
 }
 
+void Shape::resetFromTag()
+{
+	// the tags may already be deleted during shutdown
+	if (fromTag && !getSystemState()->isShuttingDown())
+	{
+		// pixels are only shared if more than one instance uses the tag
+		if (--fromTag->instancecount <= 1)
+			fromTag->rastercache.clear();
+	}
+	fromTag=nullptr;
+}
+
 bool Shape::destruct()
 {
 	graphics.reset();
-	fromTag=nullptr;
+	resetFromTag();
 	tokens.clear();
 	currentcolortransform.resetTransformation();
 	return DisplayObject::destruct();
@@ -3900,6 +3923,7 @@ bool Shape::destruct()
 void Shape::finalize()
 {
 	graphics.reset();
+	resetFromTag();
 	tokens.clear();
 	DisplayObject::finalize();
 }
@@ -3943,7 +3967,9 @@ IDrawable *Shape::invalidate(DisplayObject *target, const MATRIX &initialMatrix,
 {
 	if (this->graphics)
 		this->graphics->refreshTokens();
-	return TokenContainer::invalidate(target, initialMatrix,smoothing ? SMOOTH_MODE::SMOOTH_ANTIALIAS : SMOOTH_MODE::SMOOTH_NONE,q,cachedBitmap,!graphics.isNull());
+	// as long as the tokens are the unmodified ones from the tag, the rasterized pixels can be shared with other instances
+	ShapeRasterCache* rastercache = fromTag && graphics.isNull() && fromTag->instancecount > 1 ? &fromTag->rastercache : nullptr;
+	return TokenContainer::invalidate(target, initialMatrix,smoothing ? SMOOTH_MODE::SMOOTH_ANTIALIAS : SMOOTH_MODE::SMOOTH_NONE,q,cachedBitmap,!graphics.isNull(),rastercache);
 }
 
 ASFUNCTIONBODY_ATOM(Shape,_constructor)
@@ -279,6 +279,7 @@ protected:
 	_NR<DisplayObject> hitTestImpl(number_t x, number_t y, DisplayObject::HIT_TYPE type,bool interactiveObjectsOnly) override;
 	
 	DefineShapeTag* fromTag;
+	void resetFromTag();
 public:
 	Shape(ASWorker* wrk,Class_base* c);
 	void setupShape(lightspark::DefineShapeTag *tag, float _scaling);
@@ -104,8 +104,11 @@ void BitmapFilter::applyBlur(uint8_t* data, uint32_t width, uint32_t height, num
 
 	std::vector<RGBA> ssx;
 	ssx.resize(divx);
+	// one ring of divy pixels and one sum per channel for every column, see the vertical pass below
 	std::vector<RGBA> ssy;
-	ssy.resize(divy);
+	ssy.resize(divy*w);
+	std::vector<int> sumy;
+	sumy.resize(w*4);
 
 	int mtx = MUL_TABLE[radiusX];
 	int stx = SHG_TABLE[radiusX];
@@ -178,107 +181,81 @@ void BitmapFilter::applyBlur(uint8_t* data, uint32_t width, uint32_t height, num
 		
 		ms = mty;
 		ss = sty;
+		// the vertical pass handles all columns of a row together, using per column sums and rings of pixels,
+		// so that memory is accessed row by row instead of walking down each column
 		for (x = 0; x < w; x++)
 		{
 			yi = x << 2;
-			r = ryp1 * (pr = px[yi]);
-			g = ryp1 * (pg = px[yi + 1]);
-			b = ryp1 * (pb = px[yi + 2]);
-			a = ryp1 * (pa = px[yi + 3]);
-			auto sy = ssy.begin();
-			for (i = 0; i< ryp1; i++)
+			int* sum = &sumy[yi];
+			sum[0] = ryp1 * (pr = px[yi]);
+			sum[1] = ryp1 * (pg = px[yi + 1]);
+			sum[2] = ryp1 * (pb = px[yi + 2]);
+			sum[3] = ryp1 * (pa = px[yi + 3]);
+			for (i = 0; i < ryp1; i++)
+				ssy[i*w + x] = RGBA(pr,pg,pb,pa);
+		}
+		yp = w;
+		for (i = 1; i < ryp1; i++)
+		{
+			RGBA* slot = &ssy[(radiusY + i)*w];
+			const uint8_t* row = px + (yp << 2);
+			for (x = 0; x < w; x++)
 			{
-				(*sy).Red = pr;
-				(*sy).Green = pg;
-				(*sy).Blue = pb;
-				(*sy).Alpha = pa;
-				sy++;
-				if (sy == ssy.end())
-					sy = ssy.begin();
+				int* sum = &sumy[x << 2];
+				sum[0] += (slot[x].Red = row[x << 2]);
+				sum[1] += (slot[x].Green = row[(x << 2) + 1]);
+				sum[2] += (slot[x].Blue = row[(x << 2) + 2]);
+				sum[3] += (slot[x].Alpha = row[(x << 2) + 3]);
 			}
-			yp = w;
-			for (i = 1; i < (radiusY + 1); i++)
+			if (i < h1)
 			{
-				yi = (yp + x) << 2;
-				r += ((*sy).Red = px[yi]);
-				g += ((*sy).Green = px[yi + 1]);
-				b += ((*sy).Blue = px[yi + 2]);
-				a += ((*sy).Alpha = px[yi + 3]);
-				sy++;
-				if (sy == ssy.end())
-					sy = ssy.begin();
-				if (i < h1)
-				{
-					yp += w;
-				}
+				yp += w;
 			}
-			yi = x;
-			auto si = ssy.begin();
-			
-			if (iterations > 0)
+		}
+		int slotindex = 0;
+		for (y = 0; y < h; y++)
+		{
+			uint8_t* dst = px + ((y * w) << 2);
+			p = y + ryp1;
+			// for the last rows this is the row just written, as in the column by column version
+			const uint8_t* next = px + (((p < h1 ? p : h1) * w) << 2);
+			RGBA* slot = &ssy[slotindex*w];
+			for (x = 0; x < w; x++)
 			{
-				for (y = 0; y<h; y++)
+				int* sum = &sumy[x << 2];
+				p = x << 2;
+				pa = uint32_t(sum[3] * ms) >> ss;
+				dst[p + 3] = pa;
+				if (pa > 0)
 				{
-					p = yi << 2;
-					pa = uint32_t(a * ms) >> ss;
-					px[p + 3] = pa;
-					if (pa > 0)
+					pr = (uint32_t(sum[0] * ms) >> ss);
+					pg = (uint32_t(sum[1] * ms) >> ss);
+					pb = (uint32_t(sum[2] * ms) >> ss);
+					if (iterations == 0)
 					{
-						px[p] = (uint32_t(r * ms) >> ss);
-						px[p + 1] = (uint32_t(g * ms) >> ss);
-						px[p + 2] = (uint32_t(b * ms) >> ss);
+						pr = pr > 255 ? 255 : pr;
+						pg = pg > 255 ? 255 : pg;
+						pb = pb > 255 ? 255 : pb;
 					}
-					else
-					{
-						px[p] = px[p + 1] = px[p + 2] = 0;
-					}
-					p = y + ryp1;
-					p = (x + ((p < h1 ? p : h1) * w)) << 2;
-					r -= (*si).Red;
-					r += ((*si).Red = px[p]);
-					g -= (*si).Green;
-					g += ((*si).Green = px[p + 1]);
-					b -= (*si).Blue;
-					b += ((*si).Blue = px[p + 2]);
-					a -= (*si).Alpha;
-					a += ((*si).Alpha = px[p + 3]);
-					si++;
-					if (si == ssy.end())
-						si = ssy.begin();
-					yi += w;
+					dst[p] = pr;
+					dst[p + 1] = pg;
+					dst[p + 2] = pb;
 				}
-			}
-			else
-			{
-				for (y = 0; y < h; y++)
+				else
 				{
-					p = yi << 2;
-					px[p + 3] = pa = uint32_t(a * ms) >> ss;
-					if (pa > 0)
-					{
-						pr = (uint32_t(r * ms) >> ss);
-						pg = (uint32_t(g * ms) >> ss);
-						pb = (uint32_t(b * ms) >> ss);
-						px[p] = pr > 255 ? 255 : pr;
-						px[p + 1] = pg > 255 ? 255 : pg;
-						px[p + 2] = pb > 255 ? 255 : pb;
-					}
-					else
-					{
-						px[p] = px[p + 1] = px[p + 2] = 0;
-					}
-					p = y + ryp1;
-					p = (x + ((p < h1 ? p : h1) * w)) << 2;
-					r -= (*si).Red - ((*si).Red = px[p]);
-					g -= (*si).Green - ((*si).Green = px[p + 1]);
-					b -= (*si).Blue - ((*si).Blue = px[p + 2]);
-					a -= (*si).Alpha - ((*si).Alpha = px[p + 3]);
-					si++;
-					if (si == ssy.end())
-						si = ssy.begin();
-					yi += w;
+					dst[p] = dst[p + 1] = dst[p + 2] = 0;
 				}
+				sum[0] += next[p] - slot[x].Red;
+				slot[x].Red = next[p];
+				sum[1] += next[p + 1] - slot[x].Green;
+				slot[x].Green = next[p + 1];
+				sum[2] += next[p + 2] - slot[x].Blue;
+				slot[x].Blue = next[p + 2];
+				sum[3] += next[p + 3] - slot[x].Alpha;
+				slot[x].Alpha = next[p + 3];
 			}
+			if (++slotindex == divy)
+				slotindex = 0;
 		}
 	}
 }
@@ -903,6 +903,8 @@ ASWorker::ASWorker(SystemState* s):
 	limits.script_timeout = 20;
 	stacktrace = new stacktrace_entry[limits.max_recursion];
 	gettimeofday(&last_garbagecollection, nullptr);
+	garbagecollectionpending=false;
+	garbagecollectionmaxpause=0;
 }
 
 ASWorker::ASWorker(Class_base* c):
@@ -918,6 +920,8 @@ ASWorker::ASWorker(Class_base* c):
 	stacktrace = new stacktrace_entry[limits.max_recursion];
 	loader = _MR(Class<Loader>::getInstanceS(this));
 	gettimeofday(&last_garbagecollection, nullptr);
+	garbagecollectionpending=false;
+	garbagecollectionmaxpause=0;
 }
 ASWorker::ASWorker(ASWorker* wrk, Class_base* c):
 	EventDispatcher(wrk,c),parser(nullptr),
@@ -932,6 +936,8 @@ ASWorker::ASWorker(ASWorker* wrk, Class_base* c):
 	stacktrace = new stacktrace_entry[limits.max_recursion];
 	loader = _MR(Class<Loader>::getInstanceS(this));
 	gettimeofday(&last_garbagecollection, nullptr);
+	garbagecollectionpending=false;
+	garbagecollectionmaxpause=0;
 }
 
 void ASWorker::finalize()
@@ -997,6 +1003,10 @@ void ASWorker::finalize()
 	inShutdown=true;
 	if (getWorker()==this)
 		setTLSWorker(nullptr);
+	// delete pooled objects while their classes still exist
+	for (uint32_t i = 0; i < asClassCount; i++)
+		freelist[i].clear();
+	freelist_syntheticfunction.clear();
 	// destruct all constant refs
 	auto it = constantrefs.begin();
 	it = constantrefs.begin();
@@ -1110,7 +1120,10 @@ void ASWorker::execute()
 		event_queue_mutex.lock();
 		while(events_queue.empty() && !this->threadAborting)
 			sem_event_cond.wait(event_queue_mutex);
+		// don't block threads posting events while collecting, this thread is the only one removing events from the queue
+		event_queue_mutex.unlock();
 		processGarbageCollection(false);
+		event_queue_mutex.lock();
 		if (this->threadAborting)
 		{
 			if(events_queue.empty())
@@ -1236,13 +1249,21 @@ void ASWorker::processGarbageCollection(bool force)
 {
 	struct timeval currtime;
 	gettimeofday(&currtime, nullptr);
-	int diff =  last_garbagecollection.tv_sec-currtime.tv_sec;
-	if (!force && diff < 10) // ony execute garbagecollection every 10 seconds
+	int diff =  currtime.tv_sec-last_garbagecollection.tv_sec;
+	if (!force && !garbagecollectionpending && diff < GARBAGECOLLECTION_INTERVAL) // ony execute garbagecollection every 10 seconds
 		return;
 	last_garbagecollection = currtime;
 	inGarbageCollection=true;
+	uint64_t starttime = compat_msectiming();
+	garbagecollectionpending=false;
 	while (!garbagecollection.empty())
 	{
+		if (!force && compat_msectiming()-starttime >= GARBAGECOLLECTION_TIMEBUDGET)
+		{
+			// continue with the remaining objects the next time we are idle
+			garbagecollectionpending=true;
+			break;
+		}
 		auto it = garbagecollection.begin();
 		ASObject* o = *it;
 		garbagecollection.erase(it);
@@ -1257,6 +1278,12 @@ void ASWorker::processGarbageCollection(bool force)
 		}
 	}
 	inGarbageCollection=false;
+	uint64_t pause = compat_msectiming()-starttime;
+	if (pause > garbagecollectionmaxpause)
+	{
+		garbagecollectionmaxpause = pause;
+		LOG(LOG_INFO,"garbage collection took "<<pause<<"ms, "<<garbagecollection.size()<<" objects pending");
+	}
 }
 
 void ASWorker::registerConstantRef(ASObject* obj)
@@ -29,6 +29,10 @@
 #include <sys/time.h>
 
 #define MIN_DOMAIN_MEMORY_LIMIT 1024
+// interval in seconds between two runs of the cyclic garbage collector
+#define GARBAGECOLLECTION_INTERVAL 10
+// maximum time in milliseconds a non-forced garbage collection run may take, the remaining candidates are handled in the next run
+#define GARBAGECOLLECTION_TIMEBUDGET 5
 namespace lightspark
 {
 
@@ -337,6 +341,9 @@ private:
 	std::unordered_set<ASObject*> garbagecollectiondeleted;
 	std::unordered_set<ASObject*> constantrefs;
 	struct timeval last_garbagecollection;
+	// true if the last garbage collection run was interrupted because it exceeded its time budget
+	bool garbagecollectionpending;
+	uint64_t garbagecollectionmaxpause;
 	std::vector<ABCContext*> contexts;
 public:
 	asfreelist* freelist;
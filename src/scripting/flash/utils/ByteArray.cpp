@@ -1502,36 +1502,47 @@ void ByteArray::uncompress_zlib(bool raw)
 	else if(status!=Z_OK)
 		throw RunTimeException("zlib uncompress failed");
 
-	vector<uint8_t> buf(3*len);
+	// the output buffer grows geometrically and is handed over to the ByteArray afterwards,
+	// so that large payloads are not copied over and over while inflating
+	uint32_t buflen=3*len;
+	uint8_t* buf=new uint8_t[buflen];
 	do
 	{
-		strm.next_out=&buf[strm.total_out];
-		strm.avail_out=buf.size()-strm.total_out;
+		strm.next_out=buf+strm.total_out;
+		strm.avail_out=buflen-strm.total_out;
 		status=inflate(&strm, Z_NO_FLUSH);
 
 		if(status!=Z_OK && status!=Z_STREAM_END)
 		{
 			inflateEnd(&strm);
+			delete[] buf;
 			createError<IOError>(getInstanceWorker(),0,"not valid compressed data");
 			return;
 		}
 
-		if(strm.avail_out==0)
-			buf.resize(buf.size()+len);
+		if(strm.avail_out==0 && status!=Z_STREAM_END)
+		{
+			uint8_t* buf2=new uint8_t[buflen*2];
+			memcpy(buf2,buf,strm.total_out);
+			delete[] buf;
+			buf=buf2;
+			buflen*=2;
+		}
 	} while(status!=Z_STREAM_END);
 
 	inflateEnd(&strm);
 
+	if(buflen > 2*strm.total_out)
+	{
+		// don't keep more than twice the needed memory around
+		uint8_t* buf2=new uint8_t[strm.total_out];
+		memcpy(buf2,buf,strm.total_out);
+		delete[] buf;
+		buf=buf2;
+		buflen=strm.total_out;
+	}
+	acquireBuffer(buf,buflen);
 	len=strm.total_out;
-#ifdef MEMORY_USAGE_PROFILING
-	getClass()->memoryAccount->addBytes(len-real_len);
-#endif
-	real_len = len;
-	uint8_t* bytes2 = new uint8_t[len];
-	assert_and_throw(bytes2);
-	delete[] bytes;
-	bytes = bytes2;
-	memcpy(bytes, &buf[0], len);
 	position=0;
 }
 
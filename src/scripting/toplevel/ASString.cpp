@@ -336,7 +336,6 @@ ASFUNCTIONBODY_ATOM(ASString,split)
 		int infoOk=pcre_fullinfo(pcreRE, nullptr, PCRE_INFO_CAPTURECOUNT, &capturingGroups);
 		if(infoOk!=0)
 		{
-			pcre_free(pcreRE);
 			ret = asAtomHandler::fromObject(res);
 			return;
 		}
@@ -382,7 +381,6 @@ ASFUNCTIONBODY_ATOM(ASString,split)
 			ASObject* s=abstract_s(wrk,data.substr_bytes(lastMatch,data.numBytes()-lastMatch));
 			res->push(asAtomHandler::fromObject(s));
 		}
-		pcre_free(pcreRE);
 	}
 	else
 	{
@@ -999,7 +997,6 @@ ASFUNCTIONBODY_ATOM(ASString,replace)
 		int infoOk=pcre_fullinfo(pcreRE, nullptr, PCRE_INFO_CAPTURECOUNT, &capturingGroups);
 		if(infoOk!=0)
 		{
-			pcre_free(pcreRE);
 			ret = asAtomHandler::fromObject(res);
 			return;
 		}
@@ -1017,7 +1014,6 @@ ASFUNCTIONBODY_ATOM(ASString,replace)
 			if(rc<0)
 			{
 				//No matches or error
-				pcre_free(pcreRE);
 				ret = asAtomHandler::fromObject(res);
 				return;
 			}
@@ -1098,7 +1094,6 @@ ASFUNCTIONBODY_ATOM(ASString,replace)
 			retDiff+=replaceWithTmp.numBytes()-(ovector[1]-ovector[0]);
 		}
 		while(re->global);
-		pcre_free(pcreRE);
 	}
 	else
 	{
@@ -23,16 +23,38 @@
 using namespace std;
 using namespace lightspark;
 
-RegExp::RegExp(ASWorker* wrk, Class_base* c):ASObject(wrk,c,T_OBJECT,SUBTYPE_REGEXP),dotall(false),global(false),ignoreCase(false),
-	extended(false),multiline(false),lastIndex(0)
+RegExp::RegExp(ASWorker* wrk, Class_base* c):ASObject(wrk,c,T_OBJECT,SUBTYPE_REGEXP),compiledpattern{nullptr,nullptr},compiledoptions{0,0},
+	dotall(false),global(false),ignoreCase(false),extended(false),multiline(false),lastIndex(0)
 {
 }
 
-RegExp::RegExp(ASWorker* wrk,Class_base* c, const tiny_string& _re):ASObject(wrk,c,T_OBJECT,SUBTYPE_REGEXP),dotall(false),global(false),ignoreCase(false),
-	extended(false),multiline(false),lastIndex(0),source(_re)
+RegExp::RegExp(ASWorker* wrk,Class_base* c, const tiny_string& _re):ASObject(wrk,c,T_OBJECT,SUBTYPE_REGEXP),compiledpattern{nullptr,nullptr},compiledoptions{0,0},
+	dotall(false),global(false),ignoreCase(false),extended(false),multiline(false),lastIndex(0),source(_re)
 {
 }
 
+RegExp::~RegExp()
+{
+	clearCompiledPatterns();
+}
+
+bool RegExp::destruct()
+{
+	clearCompiledPatterns();
+	return destructIntern();
+}
+
+void RegExp::clearCompiledPatterns()
+{
+	for (int i = 0; i < 2; i++)
+	{
+		if (compiledpattern[i])
+			pcre_free(compiledpattern[i]);
+		compiledpattern[i]=nullptr;
+		compiledoptions[i]=0;
+	}
+}
+
 void RegExp::sinit(Class_base* c)
 {
 	CLASS_SETUP(c, ASObject, _constructor, CLASS_DYNAMIC_NOT_FINAL);
@@ -62,6 +84,7 @@ void RegExp::buildTraits(ASObject* o)
 ASFUNCTIONBODY_ATOM(RegExp,_constructor)
 {
 	RegExp* th=asAtomHandler::as<RegExp>(obj);
+	th->clearCompiledPatterns();
 	if(argslen > 0 && asAtomHandler::is<RegExp>(args[0]))
 	{
 		if(argslen > 1 && !asAtomHandler::is<Undefined>(args[1]))
@@ -156,7 +179,6 @@ ASObject *RegExp::match(const tiny_string& str)
 	int infoOk=pcre_fullinfo(pcreRE, nullptr, PCRE_INFO_CAPTURECOUNT, &capturingGroups);
 	if(infoOk!=0)
 	{
-		pcre_free(pcreRE);
 		return getSystemState()->getNullRef();
 	}
 	//Get information about named capturing groups
@@ -164,7 +186,6 @@ ASObject *RegExp::match(const tiny_string& str)
 	infoOk=pcre_fullinfo(pcreRE, nullptr, PCRE_INFO_NAMECOUNT, &namedGroups);
 	if(infoOk!=0)
 	{
-		pcre_free(pcreRE);
 		return getSystemState()->getNullRef();
 	}
 	//Get information about the size of named entries
@@ -172,7 +193,6 @@ ASObject *RegExp::match(const tiny_string& str)
 	infoOk=pcre_fullinfo(pcreRE, nullptr, PCRE_INFO_NAMEENTRYSIZE, &namedSize);
 	if(infoOk!=0)
 	{
-		pcre_free(pcreRE);
 		return getSystemState()->getNullRef();
 	}
 	struct nameEntry
@@ -184,7 +204,6 @@ ASObject *RegExp::match(const tiny_string& str)
 	infoOk=pcre_fullinfo(pcreRE, nullptr, PCRE_INFO_NAMETABLE, &entries);
 	if(infoOk!=0)
 	{
-		pcre_free(pcreRE);
 		lastIndex=0;
 		return getSystemState()->getNullRef();
 	}
@@ -196,7 +215,6 @@ ASObject *RegExp::match(const tiny_string& str)
 	if(offset<0)
 	{
 		//beyond last match
-		pcre_free(pcreRE);
 		lastIndex=0;
 		return getSystemState()->getNullRef();
 	}
@@ -204,7 +222,6 @@ ASObject *RegExp::match(const tiny_string& str)
 	if(rc<0)
 	{
 		//No matches or error
-		pcre_free(pcreRE);
 		lastIndex=0;
 		return getSystemState()->getNullRef();
 	}
@@ -234,7 +251,6 @@ ASObject *RegExp::match(const tiny_string& str)
 		entries+=namedSize;
 	}
 	lastIndex=ovector[1];
-	pcre_free(pcreRE);
 	return a;
 }
 
@@ -260,7 +276,6 @@ ASFUNCTIONBODY_ATOM(RegExp,test)
 	int infoOk=pcre_fullinfo(pcreRE, NULL, PCRE_INFO_CAPTURECOUNT, &capturingGroups);
 	if(infoOk!=0)
 	{
-		pcre_free(pcreRE);
 		asAtomHandler::setNull(ret);
 		return;
 	}
@@ -272,7 +287,6 @@ ASFUNCTIONBODY_ATOM(RegExp,test)
 	extra.flags = PCRE_EXTRA_MATCH_LIMIT_RECURSION;
 	int rc = pcre_exec(pcreRE, &extra, arg0.raw_buf(), arg0.numBytes(), offset, PCRE_NO_UTF8_CHECK, ovector, (capturingGroups+1)*3);
 	bool res = (rc >= 0);
-	pcre_free(pcreRE);
 	asAtomHandler::setBool(ret,res);
 }
 
@@ -319,6 +333,10 @@ pcre* RegExp::compile(bool isutf8)
 	if(dotall)
 		options|=PCRE_DOTALL;
 
+	// source and flags only change in the constructor, so a pattern compiled with the same options can be reused
+	if (compiledpattern[isutf8] && compiledoptions[isutf8]==options)
+		return compiledpattern[isutf8];
+
 	const char * error;
 	int errorOffset;
 	int errorcode;
@@ -333,5 +351,9 @@ pcre* RegExp::compile(bool isutf8)
 		if (error)
 			return nullptr;
 	}
+	if (compiledpattern[isutf8])
+		pcre_free(compiledpattern[isutf8]);
+	compiledpattern[isutf8]=pcreRE;
+	compiledoptions[isutf8]=options;
 	return pcreRE;
 }
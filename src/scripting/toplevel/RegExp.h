@@ -28,9 +28,17 @@ namespace lightspark
 
 class RegExp: public ASObject
 {
+private:
+	// compiled patterns for single byte and utf8 strings, reused until the RegExp is destructed
+	pcre* compiledpattern[2];
+	int compiledoptions[2];
+	void clearCompiledPatterns();
 public:
 	RegExp(ASWorker* wrk,Class_base* c);
 	RegExp(ASWorker* wrk, Class_base* c, const tiny_string& _re);
+	~RegExp();
+	bool destruct() override;
+	// the returned pattern is owned by the RegExp and must not be freed by the caller
 	pcre* compile(bool isutf8);
 	static void sinit(Class_base* c);
 	static void buildTraits(ASObject* o);
@@ -103,8 +103,9 @@ void Vector::sinit(Class_base* c)
 	c->prototype->setVariableByQName("unshift",nsNameAndKind(c->getSystemState(),BUILTIN_STRINGS::STRING_AS3NS,NAMESPACE),Class<IFunction>::getFunction(c->getSystemState(),unshift),CONSTANT_TRAIT);
 }
 
-Vector::Vector(ASWorker* wrk, Class_base* c, const Type *vtype):ASObject(wrk,c,T_OBJECT,SUBTYPE_VECTOR),vec_type(vtype),fixed(false),vec(reporter_allocator<asAtom>(c->memoryAccount))
+Vector::Vector(ASWorker* wrk, Class_base* c, const Type *vtype):ASObject(wrk,c,T_OBJECT,SUBTYPE_VECTOR),vec_type(vtype),vec_primitive(VECTOR_PRIMITIVE_NONE),fixed(false),vec(reporter_allocator<asAtom>(c->memoryAccount))
 {
+	setPrimitiveType();
 }
 
 Vector::~Vector()
@@ -122,6 +123,7 @@ bool Vector::destruct()
 	}
 	vec.clear();
 	vec_type=nullptr;
+	vec_primitive=VECTOR_PRIMITIVE_NONE;
 	return destructIntern();
 }
 
@@ -136,6 +138,7 @@ void Vector::finalize()
 	}
 	vec.clear();
 	vec_type=nullptr;
+	vec_primitive=VECTOR_PRIMITIVE_NONE;
 }
 
 void Vector::prepareShutdown()
@@ -168,6 +171,20 @@ void Vector::setTypes(const std::vector<const Type *> &types)
 	assert(vec_type == nullptr);
 	if(types.size() == 1)
 		vec_type = types[0];
+	setPrimitiveType();
+}
+void Vector::setPrimitiveType()
+{
+	if (vec_type == nullptr)
+		vec_primitive = VECTOR_PRIMITIVE_NONE;
+	else if (vec_type == Class<Integer>::getClass(getSystemState()))
+		vec_primitive = VECTOR_PRIMITIVE_INT;
+	else if (vec_type == Class<UInteger>::getClass(getSystemState()))
+		vec_primitive = VECTOR_PRIMITIVE_UINT;
+	else if (vec_type == Class<Number>::getClass(getSystemState()))
+		vec_primitive = VECTOR_PRIMITIVE_NUMBER;
+	else
+		vec_primitive = VECTOR_PRIMITIVE_NONE;
 }
 bool Vector::sameType(const Class_base *cls) const
 {
@@ -700,15 +717,35 @@ ASFUNCTIONBODY_ATOM(Vector,lastIndexOf)
 				i = j;
 		}
 	}
-	do
+	if (th->vec_primitive != VECTOR_PRIMITIVE_NONE)
 	{
-		if (asAtomHandler::isEqualStrict(th->vec[i],wrk,arg0))
+		// all elements are numeric, so strict equality is a plain number comparison
+		if (asAtomHandler::isNumeric(arg0))
 		{
-			res=i;
-			break;
+			number_t n = asAtomHandler::toNumber(arg0);
+			do
+			{
+				if (asAtomHandler::toNumber(th->vec[i]) == n)
+				{
+					res=i;
+					break;
+				}
+			}
+			while(i--);
+		}
+	}
+	else
+	{
+		do
+		{
+			if (asAtomHandler::isEqualStrict(th->vec[i],wrk,arg0))
+			{
+				res=i;
+				break;
+			}
 		}
+		while(i--);
 	}
-	while(i--);
 
 	asAtomHandler::setInt(ret,wrk,res);
 }
@@ -768,14 +805,16 @@ int Vector::capIndex(int i) const
 
 asAtom Vector::getDefaultValue()
 {
-	if (vec_type == Class<Integer>::getClass(getSystemState()))
-		return asAtomHandler::fromInt(0);
-	else if (vec_type == Class<UInteger>::getClass(getSystemState()))
-		return asAtomHandler::fromUInt(0);
-	else if (vec_type == Class<Number>::getClass(getSystemState()))
-		return asAtomHandler::fromInt(0);
-	else
-		return asAtomHandler::nullAtom;
+	switch (vec_primitive)
+	{
+		case VECTOR_PRIMITIVE_INT:
+		case VECTOR_PRIMITIVE_NUMBER:
+			return asAtomHandler::fromInt(0);
+		case VECTOR_PRIMITIVE_UINT:
+			return asAtomHandler::fromUInt(0);
+		default:
+			return asAtomHandler::nullAtom;
+	}
 }
 
 ASFUNCTIONBODY_ATOM(Vector,slice)
@@ -913,12 +952,31 @@ ASFUNCTIONBODY_ATOM(Vector,indexOf)
 		i = asAtomHandler::toInt(args[1]);
 	}
 
-	for(;i<th->size();i++)
+	if (th->vec_primitive != VECTOR_PRIMITIVE_NONE)
 	{
-		if(asAtomHandler::isEqualStrict(th->vec[i],wrk,arg0))
+		// all elements are numeric, so strict equality is a plain number comparison
+		if (asAtomHandler::isNumeric(arg0))
 		{
-			res=i;
-			break;
+			number_t n = asAtomHandler::toNumber(arg0);
+			for(;i<th->size();i++)
+			{
+				if(asAtomHandler::toNumber(th->vec[i]) == n)
+				{
+					res=i;
+					break;
+				}
+			}
+		}
+	}
+	else
+	{
+		for(;i<th->size();i++)
+		{
+			if(asAtomHandler::isEqualStrict(th->vec[i],wrk,arg0))
+			{
+				res=i;
+				break;
+			}
 		}
 	}
 	asAtomHandler::setInt(ret,wrk,res);
@@ -1184,6 +1242,24 @@ ASFUNCTIONBODY_ATOM(Vector,_sort)
 		sortComparatorWrapper c(comp);
 		qsortVector(tmp,c,0,tmp.size()-1);
 	}
+	else if (isNumeric && th->vec_primitive != VECTOR_PRIMITIVE_NONE)
+	{
+		// convert all elements once instead of on every comparison
+		std::vector<std::pair<number_t,asAtom>> keys(tmp.size());
+		for (uint32_t j = 0; j < tmp.size(); j++)
+		{
+			keys[j].first = asAtomHandler::toNumber(tmp[j]);
+			keys[j].second = tmp[j];
+			if(std::isnan(keys[j].first) && tmp.size() > 1)
+				throw RunTimeException("Cannot sort non number with Array.NUMERIC option");
+		}
+		if (isDescending)
+			sort(keys.begin(),keys.end(),[](const std::pair<number_t,asAtom>& a, const std::pair<number_t,asAtom>& b) { return b.first < a.first; });
+		else
+			sort(keys.begin(),keys.end(),[](const std::pair<number_t,asAtom>& a, const std::pair<number_t,asAtom>& b) { return a.first < b.first; });
+		for (uint32_t j = 0; j < tmp.size(); j++)
+			tmp[j] = keys[j].second;
+	}
 	else
 		sort(tmp.begin(),tmp.end(),sortComparatorDefault(isNumeric,isCaseInsensitive,isDescending));
 
@@ -1492,6 +1568,8 @@ multiname *Vector::setVariableByMultiname(multiname& name, asAtom& o, CONST_ALLO
 			if (alreadyset)
 				*alreadyset = true;
 		}
+		else if (alreadyset && replaceNumberInPlace(index,o,wrk))
+			*alreadyset = true;
 		else
 		{
 			ASObject* obj = asAtomHandler::getObject(vec[index]);
@@ -1536,6 +1614,11 @@ void Vector::setVariableByInteger(int index, asAtom &o, ASObject::CONST_ALLOWED_
 	{
 		if (vec[index].uintval != o.uintval)
 		{
+			if (replaceNumberInPlace(index,o,wrk))
+			{
+				*alreadyset=true;
+				return;
+			}
 			ASObject* obj = asAtomHandler::getObject(vec[index]);
 			if (obj)
 				obj->removeStoredMember();
@@ -235,10 +235,27 @@ public:
 
 class Vector: public ASObject
 {
+public:
+	// element types that are stored as primitive values and can be handled without coercion and dispatch
+	enum VECTOR_PRIMITIVE { VECTOR_PRIMITIVE_NONE=0, VECTOR_PRIMITIVE_INT, VECTOR_PRIMITIVE_UINT, VECTOR_PRIMITIVE_NUMBER };
+private:
 	const Type* vec_type;
+	VECTOR_PRIMITIVE vec_primitive;
 	bool fixed;
 	std::vector<asAtom, reporter_allocator<asAtom>> vec;
 	int capIndex(int i) const;
+	void setPrimitiveType();
+	// stores a Number into the Number object that is already stored at index, if it is exclusively owned by this vector
+	FORCE_INLINE bool replaceNumberInPlace(uint32_t index, const asAtom& o, ASWorker* wrk)
+	{
+		if (vec_primitive != VECTOR_PRIMITIVE_NUMBER
+				|| !asAtomHandler::isNumber(o)
+				|| !asAtomHandler::isNumber(vec[index])
+				|| !asAtomHandler::getObjectNoCheck(vec[index])->isLastRef())
+			return false;
+		asAtomHandler::replaceNumber(vec[index],wrk,asAtomHandler::toNumber(o));
+		return true;
+	}
 	class sortComparatorDefault
 	{
 	private:
@@ -271,6 +288,7 @@ public:
 
 	void setTypes(const std::vector<const Type*>& types);
 	bool sameType(const Class_base* cls) const;
+	VECTOR_PRIMITIVE getPrimitiveType() const { return vec_primitive; }
 
 	//Overloads
 	tiny_string toString();
@@ -288,6 +306,12 @@ public:
 		{
 			if (vec[index].uintval != o.uintval)
 			{
+				if (replaceNumberInPlace(index,o,wrk))
+				{
+					// the value was copied, so the caller keeps ownership of o
+					*alreadyset=true;
+					return;
+				}
 				ASObject* obj = asAtomHandler::getObject(vec[index]);
 				if (obj)
 					obj->removeStoredMember();
@@ -1232,9 +1232,15 @@ const Type* Type::getTypeFromMultiname(multiname* mn, ABCContext* context, bool
 	return typeObject ? typeObject->as<Type>() : nullptr;
 }
 
+static uint32_t nextSlotCacheId()
+{
+	static ATOMIC_INT32(slotcacheidcounter);
+	return ATOMIC_INCREMENT(slotcacheidcounter);
+}
+
 Class_base::Class_base(const QName& name, uint32_t _classID, MemoryAccount* m):ASObject(getSys()->worker,Class_object::getClass(getSys()),T_CLASS),protected_ns(getSys(),"",NAMESPACE),constructor(nullptr),
 	qualifiedClassnameID(UINT32_MAX),global(nullptr),
-	context(nullptr),class_name(name),memoryAccount(m),length(1),class_index(-1),isFinal(false),isSealed(false),isInterface(false),isReusable(false),use_protected(false),classID(_classID)
+	context(nullptr),class_name(name),memoryAccount(m),length(1),class_index(-1),isFinal(false),isSealed(false),isInterface(false),isReusable(false),use_protected(false),classID(_classID),slotcacheid(nextSlotCacheId())
 {
 	setSystemState(getSys());
 	setRefConstant();
@@ -1242,7 +1248,7 @@ Class_base::Class_base(const QName& name, uint32_t _classID, MemoryAccount* m):A
 
 Class_base::Class_base(const Class_object* c):ASObject((MemoryAccount*)nullptr),protected_ns(getSys(),BUILTIN_STRINGS::EMPTY,NAMESPACE),constructor(nullptr),
 	qualifiedClassnameID(UINT32_MAX),global(nullptr),
-	context(nullptr),class_name(BUILTIN_STRINGS::STRING_CLASS,BUILTIN_STRINGS::EMPTY),memoryAccount(nullptr),length(1),class_index(-1),isFinal(false),isSealed(false),isInterface(false),isReusable(false),use_protected(false),classID(UINT32_MAX)
+	context(nullptr),class_name(BUILTIN_STRINGS::STRING_CLASS,BUILTIN_STRINGS::EMPTY),memoryAccount(nullptr),length(1),class_index(-1),isFinal(false),isSealed(false),isInterface(false),isReusable(false),use_protected(false),classID(UINT32_MAX),slotcacheid(nextSlotCacheId())
 {
 	type=T_CLASS;
 	//We have tested that (Class is Class == true) so the classdef is 'this'
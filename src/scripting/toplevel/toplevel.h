@@ -208,6 +208,8 @@ private:
 	bool use_protected:1;
 public:
 	uint32_t classID;
+	// unique id of this class used by multiname slot caches, never reused for another class
+	uint32_t slotcacheid;
 	void addConstructorGetter();
 	void addPrototypeGetter();
 	void addLengthGetter();
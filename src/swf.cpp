@@ -250,7 +250,7 @@ SystemState::SystemState(uint32_t fileSize, FLASH_MODE mode):
 	showProfilingData(false),allowFullscreen(false),flashMode(mode),swffilesize(fileSize),avm1global(nullptr),
 	currentVm(nullptr),builtinClasses(nullptr),useInterpreter(true),useFastInterpreter(false),useJit(false),ignoreUnhandledExceptions(false),exitOnError(ERROR_NONE),
 	systemDomain(nullptr),worker(nullptr),workerDomain(nullptr),singleworker(true),
-	downloadManager(nullptr),extScriptObject(nullptr),scaleMode(SHOW_ALL),unaccountedMemory(nullptr),tagsMemory(nullptr),stringMemory(nullptr),textTokenMemory(nullptr),shapeTokenMemory(nullptr),morphShapeTokenMemory(nullptr),bitmapTokenMemory(nullptr),spriteTokenMemory(nullptr),
+	downloadManager(nullptr),extScriptObject(nullptr),scaleMode(SHOW_ALL),unaccountedMemory(nullptr),tagsMemory(nullptr),stringMemory(nullptr),textTokenMemory(nullptr),shapeTokenMemory(nullptr),morphShapeTokenMemory(nullptr),bitmapTokenMemory(nullptr),spriteTokenMemory(nullptr),freelistMemory(nullptr),
 	static_SoundMixer_bufferTime(0),static_Multitouch_inputMode("gesture"),isinitialized(false)
 {
 	//Forge the builtin strings
@@ -299,6 +299,7 @@ SystemState::SystemState(uint32_t fileSize, FLASH_MODE mode):
 	morphShapeTokenMemory = allocateMemoryAccount("Tokens.MorphShape");
 	bitmapTokenMemory = allocateMemoryAccount("Tokens.Bitmap");
 	spriteTokenMemory = allocateMemoryAccount("Tokens.Sprite");
+	freelistMemory = allocateMemoryAccount("Freelists");
 
 	builtinClasses = new Class_base*[asClassCount];
 	memset(builtinClasses,0,asClassCount*sizeof(Class_base*));
@@ -1251,8 +1252,15 @@ ThreadProfile* SystemState::allocateProfiler(const lightspark::RGB& color)
 	return ret;
 }
 
+void SystemState::signalStageChanged()
+{
+	if (renderThread)
+		renderThread->setStageChanged();
+}
+
 void SystemState::addToInvalidateQueue(_R<DisplayObject> d)
 {
+	signalStageChanged();
 	Locker l(invalidateQueueLock);
 	//Check if the object is already in the queue
 	if(!d->invalidateQueueNext.isNull() || d==invalidateQueueTail || !EngineData::enablerendering)
@@ -2190,6 +2198,7 @@ RGB RootMovieClip::getBackground()
 void RootMovieClip::setBackground(const RGB& bg)
 {
 	Background=bg;
+	getSystemState()->signalStageChanged();
 }
 
 /* called in parser's thread context */
@@ -357,6 +357,8 @@ public:
 	void tick() override;
 	void tickFence() override;
 	RenderThread* getRenderThread() const { return renderThread; }
+	// notifies the render thread that the stage has to be rendered again
+	void signalStageChanged();
 	InputThread* getInputThread() const { return inputThread; }
 	void setParamsAndEngine(EngineData* e, bool s) DLL_PUBLIC;
 	void setDownloadedPath(const tiny_string& p) DLL_PUBLIC;
@@ -515,6 +517,8 @@ public:
 	MemoryAccount* morphShapeTokenMemory;
 	MemoryAccount* bitmapTokenMemory;
 	MemoryAccount* spriteTokenMemory;
+	// destructed objects kept in the per class freelists for reuse
+	MemoryAccount* freelistMemory;
 #ifdef MEMORY_USAGE_PROFILING
 	void saveMemoryUsageInformation(std::ofstream& out, int snapshotCount) const;
 #endif
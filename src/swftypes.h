@@ -123,6 +123,7 @@ typedef double number_t;
 class Type;
 class SystemState;
 class ASObject;
+class Class_base;
 class ASString;
 class ABCContext;
 class URLInfo;
@@ -428,6 +429,18 @@ struct multiname: public memory_reporter
 	std::vector<nsNameAndKind, reporter_allocator<nsNameAndKind>> ns;
 	const Type* cachedType;
 	std::vector<multiname*> templateinstancenames;
+	// inline cache for property access on instances of sealed classes:
+	// all instances of a sealed class share the same slot layout, so we remember
+	// the slot this name resolved to for the last two classes it was used on.
+	// The name and namespace are stored as well, as some multinames are reused for different names
+	struct slotcacheentry
+	{
+		uint32_t classid; // Class_base::slotcacheid, 0 if unused
+		uint32_t nameid;
+		uint32_t nsid;
+		uint32_t slotid;
+	};
+	mutable slotcacheentry cachedslots[2];
 	enum NAME_TYPE {NAME_STRING,NAME_INT,NAME_UINT,NAME_NUMBER,NAME_OBJECT};
 	NAME_TYPE name_type:3;
 	bool isAttribute:1;
@@ -438,6 +451,20 @@ struct multiname: public memory_reporter
 	bool isInteger:1;
 	multiname(MemoryAccount* m):name_s_id(UINT32_MAX),name_o(nullptr),ns(reporter_allocator<nsNameAndKind>(m)),cachedType(nullptr),name_type(NAME_OBJECT),isAttribute(false),isStatic(true),hasEmptyNS(true),hasBuiltinNS(false),hasGlobalNS(true),isInteger(false)
 	{
+		cachedslots[0]=cachedslots[1]={0,0,0,0};
+	}
+	FORCE_INLINE const slotcacheentry* getCachedSlot(uint32_t classid) const
+	{
+		if (cachedslots[0].classid==classid)
+			return &cachedslots[0];
+		if (cachedslots[1].classid==classid)
+			return &cachedslots[1];
+		return nullptr;
+	}
+	FORCE_INLINE void setCachedSlot(uint32_t classid, uint32_t nsid, uint32_t slotid) const
+	{
+		cachedslots[1]=cachedslots[0];
+		cachedslots[0]={classid,name_s_id,nsid,slotid};
 	}
 	
 	/*
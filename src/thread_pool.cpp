@@ -27,7 +27,7 @@
 
 using namespace lightspark;
 
-ThreadPool::ThreadPool(SystemState* s):num_jobs(0),stopFlag(false),runcount(0)
+ThreadPool::ThreadPool(SystemState* s):num_jobs(0),stopFlag(false),runcount(0),additionalrunning(0),additionalidle(0),maxadditionalrunning(0),maxqueuedepth(0)
 {
 	m_sys=s;
 	for(uint32_t i=0;i<NUM_THREADS;i++)
@@ -41,36 +41,45 @@ ThreadPool::ThreadPool(SystemState* s):num_jobs(0),stopFlag(false),runcount(0)
 
 void ThreadPool::forceStop()
 {
-	if(!stopFlag)
 	{
+		Locker l(mutex);
+		if(stopFlag)
+			return;
 		stopFlag=true;
 		//Signal an event for all the threads
 		for(int i=0;i<NUM_THREADS;i++)
 			num_jobs.signal();
+		additionalJobAvailable.broadcast();
 
+		//Now abort any job that is still executing
+		for(int i=0;i<NUM_THREADS;i++)
 		{
-			Locker l(mutex);
-			//Now abort any job that is still executing
-			for(int i=0;i<NUM_THREADS;i++)
+			if(curJobs[i])
 			{
-				if(curJobs[i])
-				{
-					curJobs[i]->threadAborting = true;
-					curJobs[i]->threadAbort();
-				}
+				curJobs[i]->threadAborting = true;
+				curJobs[i]->threadAbort();
 			}
-			//Fence all the non executed jobs
-			std::deque<IThreadJob*>::iterator it=jobs.begin();
-			for(;it!=jobs.end();++it)
-				(*it)->jobFence();
-			jobs.clear();
 		}
-
-		for(int i=0;i<NUM_THREADS;i++)
+		for(auto it=additionalJobs.begin();it!=additionalJobs.end();++it)
 		{
-			SDL_WaitThread(threads[i],nullptr);
+			(*it)->threadAborting = true;
+			(*it)->threadAbort();
 		}
+		//Fence all the non executed jobs
+		std::deque<IThreadJob*>::iterator it=jobs.begin();
+		for(;it!=jobs.end();++it)
+			(*it)->jobFence();
+		jobs.clear();
+		//Additional threads access the pool after their job is done, so wait for them
+		while(additionalrunning)
+			additionalFinished.wait(mutex);
+	}
+
+	for(int i=0;i<NUM_THREADS;i++)
+	{
+		SDL_WaitThread(threads[i],nullptr);
 	}
+	LOG(LOG_INFO,"ThreadPool stopped, max queued jobs:"<<maxqueuedepth<<" max additional threads:"<<maxadditionalrunning);
 }
 
 ThreadPool::~ThreadPool()
@@ -92,9 +101,12 @@ int ThreadPool::job_worker(void *d)
 	while(1)
 	{
 		data->pool->num_jobs.wait();
+		Locker l(data->pool->mutex);
 		if(data->pool->stopFlag)
 			return 0;
-		Locker l(data->pool->mutex);
+		// the job may already have been taken by an additional thread
+		if(data->pool->jobs.empty())
+			continue;
 		IThreadJob* myJob=data->pool->jobs.front();
 		data->pool->jobs.pop_front();
 		data->pool->curJobs[data->index]=myJob;
@@ -105,8 +117,8 @@ int ThreadPool::job_worker(void *d)
 		chronometer.checkpoint();
 		try
 		{
-			// it's possible that a job was added and will be executed while forcestop() has been called
-			if(data->pool->stopFlag)
+			// it's possible that forceStop() has aborted the job before it was executed
+			if(myJob->threadAborting)
 				return 0;
 			myJob->execute();
 		}
@@ -148,47 +160,80 @@ void ThreadPool::addJob(IThreadJob* j)
 		return;
 	}
 	assert(j);
-	if (runcount == NUM_THREADS)
-	{
-		// no slot available, we create an additional thread
-		runAdditionalThread(j);
-	}
+	if (j->isUrgent())
+		jobs.push_front(j);
 	else
-	{
 		jobs.push_back(j);
+	if (jobs.size() > maxqueuedepth)
+		maxqueuedepth = jobs.size();
+	if (runcount < NUM_THREADS)
 		num_jobs.signal();
-	}
+	if (additionalidle)
+		additionalJobAvailable.signal();
+	// jobs may block until other jobs are done, so every queued job must have an idle thread that will pick it up
+	if (jobs.size() > NUM_THREADS-runcount+additionalidle)
+		runAdditionalThread();
 }
-void ThreadPool::runAdditionalThread(IThreadJob* j)
+void ThreadPool::runAdditionalThread()
 {
-	SDL_Thread* t = SDL_CreateThread(additional_job_worker,"additionalThread",j);
+	additionalrunning++;
+	additionalidle++;
+	if (additionalrunning > maxadditionalrunning)
+		maxadditionalrunning = additionalrunning;
+	SDL_Thread* t = SDL_CreateThread(additional_job_worker,"additionalThread",this);
 	SDL_DetachThread(t);
 }
 
 int ThreadPool::additional_job_worker(void* d)
 {
-	IThreadJob* myJob=(IThreadJob*)d;
+	ThreadPool* pool = (ThreadPool*)d;
 
-	setTLSSys(myJob->fromWorker->getSystemState());
-	setTLSWorker(myJob->fromWorker);
-	try
-	{
-		myJob->execute();
-	}
-	catch(JobTerminationException& ex)
-	{
-		LOG(LOG_NOT_IMPLEMENTED,"Job terminated");
-	}
-	catch(LightsparkException& e)
+	setTLSSys(pool->m_sys);
+	Locker l(pool->mutex);
+	while (true)
 	{
-		LOG(LOG_ERROR,"Exception in AdditionalThread " << e.what());
-		myJob->fromWorker->getSystemState()->setError(e.cause);
-	}
-	catch(std::exception& e)
-	{
-		LOG(LOG_ERROR,"std Exception in AdditionalThread:"<<myJob<<" "<<e.what());
-		myJob->fromWorker->getSystemState()->setError(e.what());
+		// wait for queued jobs and exit if none arrives in time
+		while (!pool->stopFlag && pool->jobs.empty())
+		{
+			if (!pool->additionalJobAvailable.wait_until(pool->mutex,ADDITIONAL_THREAD_IDLE_TIMEOUT))
+				break;
+		}
+		if (pool->stopFlag || pool->jobs.empty())
+			break;
+		IThreadJob* myJob=pool->jobs.front();
+		pool->jobs.pop_front();
+		pool->additionalJobs.insert(myJob);
+		pool->additionalidle--;
+		l.release();
+
+		setTLSWorker(myJob->fromWorker);
+		try
+		{
+			myJob->execute();
+		}
+		catch(JobTerminationException& ex)
+		{
+			LOG(LOG_NOT_IMPLEMENTED,"Job terminated");
+		}
+		catch(LightsparkException& e)
+		{
+			LOG(LOG_ERROR,"Exception in AdditionalThread " << e.what());
+			pool->m_sys->setError(e.cause);
+		}
+		catch(std::exception& e)
+		{
+			LOG(LOG_ERROR,"std Exception in AdditionalThread:"<<myJob<<" "<<e.what());
+			pool->m_sys->setError(e.what());
+		}
+		l.acquire();
+		pool->additionalJobs.erase(myJob);
+		l.release();
+		myJob->jobFence();
+		l.acquire();
+		pool->additionalidle++;
 	}
-	myJob->jobFence();
+	pool->additionalidle--;
+	if (--pool->additionalrunning == 0)
+		pool->additionalFinished.broadcast();
 	return 0;
 }
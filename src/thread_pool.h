@@ -22,6 +22,7 @@
 
 #include "compat.h"
 #include <deque>
+#include <set>
 #include <cstdlib>
 #include "threading.h"
 
@@ -29,6 +30,8 @@ namespace lightspark
 {
 
 #define NUM_THREADS 20
+// time in milliseconds an idle additional thread waits for queued jobs before it exits
+#define ADDITIONAL_THREAD_IDLE_TIMEOUT 5000
 
 class SystemState;
 
@@ -48,9 +51,20 @@ private:
 	Semaphore num_jobs;
 	static int job_worker(void* d);
 	SystemState* m_sys;
-	volatile bool stopFlag;
+	// only accessed with mutex locked
+	bool stopFlag;
 	uint32_t runcount;
-	void runAdditionalThread(IThreadJob* j);
+	// jobs executed in additional threads, only accessed with mutex locked
+	std::set<IThreadJob*> additionalJobs;
+	Cond additionalFinished;
+	// signaled when a job is queued while additional threads are idle
+	Cond additionalJobAvailable;
+	uint32_t additionalrunning;
+	uint32_t additionalidle;
+	// statistics, only accessed with mutex locked
+	uint32_t maxadditionalrunning;
+	uint32_t maxqueuedepth;
+	void runAdditionalThread();
 	static int additional_job_worker(void* d);
 public:
 	ThreadPool(SystemState* s);
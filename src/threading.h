@@ -180,6 +180,11 @@ public:
 	 * 'delete this'.
 	 */
 	virtual void jobFence()=0;
+	/*
+	 * Short jobs that the rendering is waiting for may return true
+	 * to be executed before the other pending jobs
+	 */
+	virtual bool isUrgent() const { return false; }
 	IThreadJob() : fromWorker(nullptr),threadAborting(false) {}
 	virtual ~IThreadJob() {}
 	void setWorker(ASWorker* w) { fromWorker = w;}
@@ -268,8 +273,8 @@ private:
 	gint64 timepoint;
 public:
 	CondTime(long milliseconds);
-	bool operator<(CondTime& c) const;
-	bool operator>(CondTime& c) const;
+	bool operator<(const CondTime& c) const;
+	bool operator>(const CondTime& c) const;
 	bool isInTheFuture() const;
 	void addMilliseconds(long ms);
 	bool wait(Mutex &mutex, Cond& cond);
@@ -52,37 +52,41 @@ void TimerThread::wait()
 TimerThread::~TimerThread()
 {
 	stop();
-	list<TimingEvent*>::iterator it=pendingEvents.begin();
-	for(;it!=pendingEvents.end();++it)
+	for(auto it=pendingEvents.begin();it!=pendingEvents.end();++it)
 	{
-		if ((*it)->job)
-			(*it)->job->tickFence();
-		delete *it;
+		if (it->second->job)
+			it->second->job->tickFence();
+		delete it->second;
 	}
+	pendingEvents.clear();
+	pendingJobs.clear();
 }
 
 void TimerThread::insertNewEvent_nolock(TimingEvent* e)
 {
-	list<TimingEvent*>::iterator it=pendingEvents.begin();
 	//If there are no events pending, or this is earlier than the first, signal newEvent
-	if(pendingEvents.empty() || (*it)->wakeUpTime > e->wakeUpTime)
-	{
-		pendingEvents.insert(it, e);
+	bool first = pendingEvents.empty() || pendingEvents.begin()->first > e->wakeUpTime;
+	//multimap inserts after all events with the same wakeUpTime
+	EventQueue::iterator it=pendingEvents.insert(make_pair(e->wakeUpTime,e));
+	pendingJobs.insert(make_pair(e->job,it));
+	if(first)
 		newEvent.signal();
-		return;
-	}
-	++it;
+}
 
-	for(;it!=pendingEvents.end();++it)
+TimerThread::TimingEvent* TimerThread::popEvent_nolock(EventQueue::iterator it)
+{
+	TimingEvent* e=it->second;
+	auto range=pendingJobs.equal_range(e->job);
+	for(auto itjob=range.first;itjob!=range.second;++itjob)
 	{
-		if((*it)->wakeUpTime > e->wakeUpTime)
+		if(itjob->second==it)
 		{
-			pendingEvents.insert(it, e);
-			return;
+			pendingJobs.erase(itjob);
+			break;
 		}
 	}
-	//Event has to be inserted after all the others
-	pendingEvents.insert(pendingEvents.end(), e);
+	pendingEvents.erase(it);
+	return e;
 }
 
 void TimerThread::insertNewEvent(TimingEvent* e)
@@ -94,10 +98,8 @@ void TimerThread::insertNewEvent(TimingEvent* e)
 //Unsafe debugging routine
 void TimerThread::dumpJobs()
 {
-	list<TimingEvent*>::iterator it=pendingEvents.begin();
-	//Find if the job is in the list
-	for(;it!=pendingEvents.end();++it)
-		LOG(LOG_INFO, (*it)->job );
+	for(auto it=pendingEvents.begin();it!=pendingEvents.end();++it)
+		LOG(LOG_INFO, it->second->job );
 }
 
 /*
@@ -126,7 +128,7 @@ int TimerThread::worker(void *d)
 		}
 
 		/* Get expiration of first event */
-		CondTime timing=th->pendingEvents.front()->wakeUpTime;
+		CondTime timing=th->pendingEvents.begin()->first;
 		/* Wait for the absolute time or a newEvent signal
 		 * this unlocks the mutex and relocks it before returing
 		 */
@@ -138,14 +140,12 @@ int TimerThread::worker(void *d)
 		if(th->pendingEvents.empty())
 			continue;
 
-		TimingEvent* e=th->pendingEvents.front();
-
 		/* check if the top event is due now. It could be have been removed/inserted
 		 * while we slept */
-		if(e->wakeUpTime.isInTheFuture())
+		if(th->pendingEvents.begin()->first.isInTheFuture())
 			continue;
 
-		th->pendingEvents.pop_front();
+		TimingEvent* e=th->popEvent_nolock(th->pendingEvents.begin());
 
 		if(e->job->stopMe)
 		{
@@ -208,24 +208,21 @@ void TimerThread::removeJob(ITickJob* job)
 }
 void TimerThread::removeJob_noLock(ITickJob* job)
 {
-
 	/* See if that job is currently pending */
-	list<TimingEvent*>::iterator it=pendingEvents.begin();
-	bool first=true;
-	//Find if the job is in the list
-	for(;it!=pendingEvents.end();++it)
+	auto range=pendingJobs.equal_range(job);
+	if(range.first==range.second)
+		return;
+
+	//Remove the earliest event of the job
+	EventQueue::iterator it=range.first->second;
+	for(auto itjob=range.first;itjob!=range.second;++itjob)
 	{
-		if((*it)->job==job)
-			break;
-		first=false;
+		if(itjob->second->first < it->first)
+			it=itjob->second;
 	}
+	bool first = it==pendingEvents.begin();
 
-	if(it==pendingEvents.end())
-		return;
-
-	TimingEvent* e=*it;
-	pendingEvents.erase(it);
-	delete e;
+	delete popEvent_nolock(it);
 
 	/* the worker is waiting on this job, wake him up */
 	if(first)
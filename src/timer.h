@@ -21,7 +21,8 @@
 #define TIMER_H 1
 
 #include "compat.h"
-#include <list>
+#include <map>
+#include <unordered_map>
 #include <ctime>
 #include "threading.h"
 
@@ -62,16 +63,21 @@ private:
 		uint32_t tickTime;
 		bool isTick;
 	};
+	// events ordered by wakeUpTime, events with the same wakeUpTime are kept in insertion order
+	typedef std::multimap<CondTime,TimingEvent*> EventQueue;
 	Mutex mutex;
 	Cond newEvent;
 	SDL_Thread* t;
-	std::list<TimingEvent*> pendingEvents;
+	EventQueue pendingEvents;
+	// index into pendingEvents to find the events of a job without walking the queue
+	std::unordered_multimap<ITickJob*,EventQueue::iterator> pendingJobs;
 	SystemState* m_sys;
 	volatile bool stopped;
 	bool joined;
 	static int worker(void* d);
 	void insertNewEvent(TimingEvent* e);
 	void insertNewEvent_nolock(TimingEvent* e);
+	TimingEvent* popEvent_nolock(EventQueue::iterator it);
 	void dumpJobs();
 public:
 	TimerThread(SystemState* s);
@@ -0,0 +1,11 @@
+package
+{
+
+public class SlotLayoutTestCase
+{
+	public var a:int = 1;
+	public var b:String = "b";
+	public var x:int = 10;
+}
+
+}
@@ -0,0 +1,10 @@
+package
+{
+
+public class SlotLayoutTestCase2
+{
+	public var x:int = 20;
+	public var y:Number = 2.5;
+}
+
+}